@@ -1,52 +1,340 @@
-import timeit
+#!/usr/bin/env python3
+# Runs the benchmark suite.
+#
+# Every benchmark script times its own work with clock() and prints the
+# elapsed seconds as its last line, so process startup and compiling the
+# script stay out of the numbers. The compile benchmark is the exception: it
+# generates a large script and times the whole process, minus the time taken
+# to start up and run an empty script.
+#
+# With --baseline, the results are compared against a stored run, and the
+# script exits with status 1 if any benchmark got slower than its tolerance
+# allows with 95% confidence.
 
-BENCHMARK_PATH = 'benchmark/'
+from argparse import ArgumentParser
+import json
+import math
+from os.path import join
+import shutil
+import statistics
+import subprocess
+import sys
+import platform
+import tempfile
+import time
 
-ITERATE_COUNT = 5
+BENCHMARK_PATH = 'benchmark'
 
+HS_APP = './bin/hs_release'
+
+BENCHMARKS = [
+    'fib',
+    'method_call',
+    'property',
+    'string_build',
+    'array_push',
+    'closures',
+    'gc_alloc',
+    'match',
+    'array_methods',
+    'native_calls',
+    'compile',
+]
+
+# Used by --languages, which compares the same script across interpreters.
 LANGUAGES = [
-    ("hobby", "./bin/hs_release", ".hs"),
-    ("lua", "lua", ".lua"),
-    ("python", "python3", ".py"),
+    ('hobby', HS_APP, '.hs'),
+    ('lua', 'lua', '.lua'),
+    ('python', 'python3', '.py'),
 ]
 
-BENCHMARKS = [
-    "fib",
+# Literals aren't shared, and past 256 locals or constants a function needs
+# wider instructions, so the generated script is made of a moderate number
+# of large functions whose blocks only use locals.
+COMPILE_FUNCTIONS = 200
+COMPILE_BLOCKS = 150
+
+
+# How much slower than the baseline a benchmark may get, as a fraction of
+# the baseline's mean, when the baseline doesn't say.
+DEFAULT_TOLERANCE = 0.05
+
+# Two-sided 95% critical values of Student's t distribution, by degrees of
+# freedom. Larger samples use the normal distribution's 1.96.
+T_95 = [
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042,
 ]
 
-times = {}
 
+def run(command):
+    """Runs the command and returns its output and wall time in seconds."""
+    start = time.perf_counter()
+    result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.PIPE,
+                            universal_newlines=True)
+    wall = time.perf_counter() - start
+    if result.returncode != 0:
+        sys.exit('{} failed with exit code {}:\n{}'.format(
+            ' '.join(command), result.returncode, result.stderr))
+    return result.stdout, wall
+
+
+def script_time(app, path):
+    output, wall = run([app, path])
+    lines = output.strip().splitlines()
+    try:
+        return float(lines[-1]), wall
+    except (IndexError, ValueError):
+        sys.exit('{} did not print its elapsed time last.'.format(path))
+
+
+def generate_compile_source(path):
+    with open(path, 'w') as source:
+        for i in range(COMPILE_FUNCTIONS):
+            source.write('func f{}(a, b) {{\n'.format(i))
+            source.write('  var x = a + b;\n')
+            source.write('  var zero = 0;\n')
+            source.write('  var one = 1;\n')
+            source.write('  var ten = 10;\n')
+            source.write('  var items = [a, b, x];\n')
+            for _ in range(COMPILE_BLOCKS):
+                source.write('  if (x > b) {\n')
+                source.write('    x = x - items[zero] * a;\n')
+                source.write('  } else {\n')
+                source.write('    while (x < ten) { x += one; }\n')
+                source.write('  }\n')
+            source.write('  return x;\n')
+            source.write('}\n\n')
+        source.write('print(0);\n')
+
+
+def compile_times(app, runs):
+    """Times compiling a generated script, from outside the process."""
+    with tempfile.TemporaryDirectory() as directory:
+        empty = join(directory, 'empty.hs')
+        large = join(directory, 'large.hs')
+        with open(empty, 'w') as source:
+            source.write('print(0);\n')
+        generate_compile_source(large)
+
+        run([app, large])
+        startup = statistics.median(run([app, empty])[1] for _ in range(runs))
+        times = []
+        walls = []
+        for _ in range(runs):
+            wall = run([app, large])[1]
+            times.append(max(wall - startup, 0.0))
+            walls.append(wall)
+    return times, walls
+
+
+def measure(app, name, runs):
+    if name == 'compile':
+        return compile_times(app, runs)
+
+    path = join(BENCHMARK_PATH, name + '.hs')
+    # Warms up the caches and the file system.
+    script_time(app, path)
+    times = []
+    walls = []
+    for _ in range(runs):
+        elapsed, wall = script_time(app, path)
+        times.append(elapsed)
+        walls.append(wall)
+    return times, walls
+
+
+def summarize(times, walls):
+    return {
+        'times': times,
+        'median': statistics.median(times),
+        'mean': statistics.mean(times),
+        'stddev': statistics.stdev(times) if len(times) > 1 else 0.0,
+        'min': min(times),
+        'wall_median': statistics.median(walls),
+    }
+
+
+def run_suite(app, names, runs):
+    print('{:<14} {:>10} {:>10} {:>10} {:>10}'.format(
+        'benchmark', 'median ms', 'stddev', 'min ms', 'wall ms'))
+    results = {}
+    for name in names:
+        result = summarize(*measure(app, name, runs))
+        results[name] = result
+        print('{:<14} {:>10.2f} {:>9.1f}% {:>10.2f} {:>10.2f}'.format(
+            name, result['median'] * 1000,
+            100 * result['stddev'] / result['median'] if result['median'] > 0 else 0,
+            result['min'] * 1000, result['wall_median'] * 1000))
+    return results
+
+
+def machine_info():
+    cpu = platform.processor() or 'unknown'
+    try:
+        with open('/proc/cpuinfo') as cpuinfo:
+            for line in cpuinfo:
+                if line.startswith('model name'):
+                    cpu = line.split(':', 1)[1].strip()
+                    break
+    except OSError:
+        pass
+
+    flags = subprocess.run(['make', '-s', 'PROFILE=release', 'build_flags'],
+                           stdout=subprocess.PIPE, universal_newlines=True)
+    return {
+        'cpu': cpu,
+        'platform': platform.platform(),
+        'flags': flags.stdout.strip() if flags.returncode == 0 else 'unknown',
+    }
+
+
+def t_critical(df):
+    df = max(int(df), 1)
+    return T_95[df - 1] if df <= len(T_95) else 1.96
+
+
+def slowdown_interval(baseline, current):
+    """The 95% confidence interval of how much slower the current times are
+    on average, as a fraction of the baseline's mean (Welch's t-interval)."""
+    base_mean = statistics.mean(baseline)
+    base_var = statistics.variance(baseline) / len(baseline) if len(baseline) > 1 else 0.0
+    current_var = statistics.variance(current) / len(current) if len(current) > 1 else 0.0
+    difference = statistics.mean(current) - base_mean
+
+    error = math.sqrt(base_var + current_var)
+    if error == 0:
+        return difference / base_mean, difference / base_mean
+    df = (base_var + current_var) ** 2 / (
+        (base_var ** 2 / (len(baseline) - 1) if len(baseline) > 1 else 0)
+        + (current_var ** 2 / (len(current) - 1) if len(current) > 1 else 0))
+    margin = t_critical(df) * error
+    return (difference - margin) / base_mean, (difference + margin) / base_mean
+
+
+def compare(baseline, results):
+    """Prints how the results compare with the baseline and returns the
+    names of the benchmarks that regressed."""
+    if baseline.get('machine') != results['machine']:
+        print('Warning: the baseline was recorded on a different machine or build:')
+        print('  baseline: {}'.format(baseline.get('machine')))
+        print('  current:  {}'.format(results['machine']))
+
+    print()
+    print('{:<14} {:>11} {:>11} {:>8} {:>18} {:>9}  {}'.format(
+        'benchmark', 'baseline ms', 'current ms', 'change', '95% interval',
+        'tolerance', 'verdict'))
+    regressions = []
+    for name, current in results['benchmarks'].items():
+        base = baseline['benchmarks'].get(name)
+        if base is None:
+            print('{:<14} not in the baseline'.format(name))
+            continue
+
+        tolerance = base.get('tolerance', DEFAULT_TOLERANCE)
+        low, high = slowdown_interval(base['times'], current['times'])
+        change = statistics.mean(current['times']) / statistics.mean(base['times']) - 1
+        if low > tolerance:
+            verdict = 'REGRESSION'
+            regressions.append(name)
+        elif high < 0:
+            verdict = 'faster'
+        elif low > 0:
+            verdict = 'slower, within tolerance'
+        else:
+            verdict = 'no significant change'
+        print('{:<14} {:>11.2f} {:>11.2f} {:>+7.1f}% {:>+8.1f}%..{:>+6.1f}% {:>8.0f}%  {}'.format(
+            name, base['median'] * 1000, current['median'] * 1000, change * 100,
+            low * 100, high * 100, tolerance * 100, verdict))
+    return regressions
+
+
+def compare_languages(runs):
+    print('FIB RESULTS')
+    for language, app, extension in LANGUAGES:
+        if shutil.which(app) is None:
+            print('{} skipped:\t{} not found'.format(language.title(), app))
+            continue
+        path = join(BENCHMARK_PATH, 'fib' + extension)
+        walls = [run([app, path])[1] for _ in range(runs)]
+        print('{} median:\t{}ms'.format(language.title(),
+                                        round(statistics.median(walls) * 1000)))
+
+
+def main():
+    parser = ArgumentParser()
+    parser.add_argument('--runs', type=int, default=5,
+                        help='timed runs of each benchmark, after one warmup run')
+    parser.add_argument('--json', metavar='FILE',
+                        help='also write the results to FILE')
+    parser.add_argument('--baseline', metavar='FILE',
+                        help='compare with the results in FILE, and fail on a regression')
+    parser.add_argument('--save-baseline', metavar='FILE',
+                        help='write the results to FILE as the new baseline, '
+                        'keeping the tolerances already in it')
+    parser.add_argument('--languages', action='store_true',
+                        help='compare fib with the other languages instead')
+    parser.add_argument('benchmarks', nargs='*', metavar='benchmark',
+                        help='benchmarks to run, all of them by default')
+    args = parser.parse_args()
+
+    if args.languages:
+        compare_languages(args.runs)
+        return
+
+    baseline = None
+    if args.baseline:
+        with open(args.baseline) as baseline_file:
+            baseline = json.load(baseline_file)
+
+    names = args.benchmarks
+    if not names:
+        names = list(baseline['benchmarks']) if baseline else BENCHMARKS
+    for name in names:
+        if name not in BENCHMARKS:
+            sys.exit('Unknown benchmark "{}".'.format(name))
 
-def run_script(language, benchmark):
-    global times
+    results = {
+        'executable': HS_APP,
+        'runs': args.runs,
+        'machine': machine_info(),
+        'benchmarks': run_suite(HS_APP, names, args.runs),
+    }
+    if args.json:
+        write_results(args.json, results)
 
-    print("---")
-    print(language[0].upper() + ":")
-    results = []
-    path = BENCHMARK_PATH + benchmark + language[2]
-    for i in range(ITERATE_COUNT):
-        t = timeit.Timer(
-            f"run(['{language[1]}', '{path}'])",
-            setup="from subprocess import run")
-        results.append(t.timeit(1))
+    if args.save_baseline:
+        save_baseline(args.save_baseline, results)
 
-    sum = 0
-    for i in results:
-        sum += i
-    times[language[0]] = sum / len(results)
+    if baseline is not None:
+        regressions = compare(baseline, results)
+        if regressions:
+            print()
+            print('Regressed: {}'.format(', '.join(regressions)))
+            sys.exit(1)
 
 
-def run_benchmark(benchmark):
-    global times
+def write_results(path, results):
+    with open(path, 'w') as out:
+        json.dump(results, out, indent=2)
+        out.write('\n')
 
-    for i in LANGUAGES:
-        run_script(i, benchmark)
 
-    print(f"{benchmark.upper()} RESULTS")
-    for i in LANGUAGES:
-        print(f"{i[0].title()} average:\t{round(times[i[0]] * 1000)}ms")
-    times = {}
+def save_baseline(path, results):
+    tolerances = {}
+    try:
+        with open(path) as old:
+            for name, result in json.load(old)['benchmarks'].items():
+                if 'tolerance' in result:
+                    tolerances[name] = result['tolerance']
+    except (OSError, ValueError, KeyError):
+        pass
 
+    for name, result in results['benchmarks'].items():
+        result['tolerance'] = tolerances.get(name, DEFAULT_TOLERANCE)
+    write_results(path, results)
 
-run_benchmark("fib")
 
+if __name__ == '__main__':
+    main()
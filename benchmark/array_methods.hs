@@ -0,0 +1,251 @@
+// Times each native array method against the script loop it replaces.
+// The last line is the total time, for benchmark.py.
+var N = 20000;
+var REPEAT = 20;
+
+func makeArray(n) {
+  var arr = [];
+  var i = 0;
+  while (i < n) {
+    arr.push((i * 7919) % n);
+    i += 1;
+  }
+  return arr;
+}
+
+var total = clock();
+
+func report(name, native, script) {
+  print(name .. "\tnative: " .. toString(native * 1000) .. "ms\tscript: "
+    .. toString(script * 1000) .. "ms");
+}
+
+var arr = makeArray(N);
+
+// pop / push
+var start = clock();
+var r = 0;
+while (r < REPEAT) {
+  var copy = arr.slice(0, N);
+  while (copy.len() > 0) { copy.pop(); }
+  r += 1;
+}
+var native = clock() - start;
+start = clock();
+r = 0;
+while (r < REPEAT) {
+  var copy = arr.slice(0, N);
+  var n = copy.len();
+  var out = [];
+  var i = 0;
+  while (i < n - 1) { out.push(copy[i]); i += 1; }
+  r += 1;
+}
+report("pop", native, clock() - start);
+
+// insert at the front
+start = clock();
+var small = [];
+var i = 0;
+while (i < 2000) { small.insert(0, i); i += 1; }
+native = clock() - start;
+start = clock();
+small = [];
+i = 0;
+while (i < 2000) {
+  small.push(nil);
+  var j = small.len() - 1;
+  while (j > 0) { small[j] = small[j - 1]; j -= 1; }
+  small[0] = i;
+  i += 1;
+}
+report("insert", native, clock() - start);
+
+// removeAt from the front
+start = clock();
+small = makeArray(2000);
+while (small.len() > 0) { small.removeAt(0); }
+native = clock() - start;
+start = clock();
+small = makeArray(2000);
+var n = small.len();
+while (n > 0) {
+  var j = 0;
+  while (j < n - 1) { small[j] = small[j + 1]; j += 1; }
+  small.pop();
+  n -= 1;
+}
+report("removeAt", native, clock() - start);
+
+// swapRemove
+start = clock();
+small = makeArray(N);
+while (small.len() > 0) { small.swapRemove(0); }
+native = clock() - start;
+start = clock();
+small = makeArray(N);
+while (small.len() > 0) {
+  small[0] = small[small.len() - 1];
+  small.pop();
+}
+report("swapRemove", native, clock() - start);
+
+// slice
+start = clock();
+r = 0;
+while (r < REPEAT) { arr.slice(100, N - 100); r += 1; }
+native = clock() - start;
+start = clock();
+r = 0;
+while (r < REPEAT) {
+  var out = [];
+  i = 100;
+  while (i < N - 100) { out.push(arr[i]); i += 1; }
+  r += 1;
+}
+report("slice", native, clock() - start);
+
+// concat
+start = clock();
+r = 0;
+while (r < REPEAT) { arr.concat(arr); r += 1; }
+native = clock() - start;
+start = clock();
+r = 0;
+while (r < REPEAT) {
+  var out = [];
+  i = 0;
+  while (i < N) { out.push(arr[i]); i += 1; }
+  i = 0;
+  while (i < N) { out.push(arr[i]); i += 1; }
+  r += 1;
+}
+report("concat", native, clock() - start);
+
+// indexOf / contains
+start = clock();
+r = 0;
+while (r < REPEAT) { arr.indexOf(-1); arr.contains(-1); r += 1; }
+native = clock() - start;
+start = clock();
+r = 0;
+while (r < REPEAT) {
+  var found = -1;
+  i = 0;
+  while (i < N) {
+    if (arr[i] == -1) { found = i; break; }
+    i += 1;
+  }
+  i = 0;
+  while (i < N) {
+    if (arr[i] == -1) { found = i; break; }
+    i += 1;
+  }
+  r += 1;
+}
+report("indexOf", native, clock() - start);
+
+// reverse
+start = clock();
+r = 0;
+while (r < REPEAT) { arr.reverse(); r += 1; }
+native = clock() - start;
+start = clock();
+r = 0;
+while (r < REPEAT) {
+  i = 0;
+  var j = N - 1;
+  while (i < j) {
+    var tmp = arr[i];
+    arr[i] = arr[j];
+    arr[j] = tmp;
+    i += 1;
+    j -= 1;
+  }
+  r += 1;
+}
+report("reverse", native, clock() - start);
+
+// fill
+start = clock();
+r = 0;
+var filled = makeArray(N);
+while (r < REPEAT) { filled.fill(0); r += 1; }
+native = clock() - start;
+start = clock();
+r = 0;
+while (r < REPEAT) {
+  i = 0;
+  while (i < N) { filled[i] = 0; i += 1; }
+  r += 1;
+}
+report("fill", native, clock() - start);
+
+// sort, against an insertion sort in script on a smaller input
+var unsorted = makeArray(2000);
+start = clock();
+unsorted.slice(0, 2000).sort();
+native = clock() - start;
+start = clock();
+var sorted = unsorted.slice(0, 2000);
+i = 1;
+while (i < 2000) {
+  var value = sorted[i];
+  var j = i - 1;
+  while (j >= 0 && sorted[j] > value) {
+    sorted[j + 1] = sorted[j];
+    j -= 1;
+  }
+  sorted[j + 1] = value;
+  i += 1;
+}
+var scriptSort = clock() - start;
+report("sort", native, scriptSort);
+
+start = clock();
+unsorted.slice(0, 2000).sort(func(a, b) => a < b);
+report("sort(cmp)", clock() - start, scriptSort);
+
+// binarySearch against a linear scan
+sorted = makeArray(N);
+sorted.sort();
+start = clock();
+i = 0;
+while (i < 200) { sorted.binarySearch(i); i += 1; }
+native = clock() - start;
+start = clock();
+i = 0;
+while (i < 200) {
+  var j = 0;
+  while (j < N) {
+    if (sorted[j] == i) { break; }
+    j += 1;
+  }
+  i += 1;
+}
+report("binarySearch", native, clock() - start);
+
+// reserve + clear + len
+start = clock();
+r = 0;
+while (r < REPEAT) {
+  var out = [];
+  out.reserve(N);
+  i = 0;
+  while (i < N) { out.push(i); i += 1; }
+  out.clear();
+  r += 1;
+}
+native = clock() - start;
+start = clock();
+r = 0;
+while (r < REPEAT) {
+  var out = [];
+  i = 0;
+  while (i < N) { out.push(i); i += 1; }
+  out = [];
+  r += 1;
+}
+report("reserve", native, clock() - start);
+
+print(clock() - total);
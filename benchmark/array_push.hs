@@ -0,0 +1,25 @@
+// Grows arrays with push and reads them back by index.
+var start = clock();
+
+var checked = 0;
+var round = 0;
+while (round < 20) {
+  var arr = [];
+  var i = 0;
+  while (i < 100000) {
+    arr.push(i);
+    i += 1;
+  }
+  i = 0;
+  while (i < 100000) {
+    if (arr[i] == i) {
+      checked += 1;
+    }
+    arr[i] = 0;
+    i += 1;
+  }
+  round += 1;
+}
+print(checked);
+
+print(clock() - start);
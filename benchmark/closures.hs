@@ -0,0 +1,17 @@
+// Creates closures capturing locals and calls them.
+func adder(n) {
+  return func(x) => x + n;
+}
+
+var start = clock();
+
+var sum = 0;
+var i = 0;
+while (i < 1000000) {
+  var add = adder(i);
+  sum = add(sum) - i + 1;
+  i += 1;
+}
+print(sum);
+
+print(clock() - start);
@@ -0,0 +1,39 @@
+// Allocates short-lived arrays and instances while keeping a tree alive, so
+// every collection has live data to trace.
+struct Node {
+  var left;
+  var right;
+}
+
+func tree(depth) {
+  if (depth == 0) {
+    return Node {};
+  }
+  return Node { .left = tree(depth - 1), .right = tree(depth - 1) };
+}
+
+func count(node) {
+  if (node.left == nil) {
+    return 1;
+  }
+  return count(node.left) + count(node.right);
+}
+
+var start = clock();
+
+var kept = tree(14);
+var made = 0;
+var i = 0;
+while (i < 200) {
+  var temp = tree(10);
+  made += count(temp);
+  var j = 0;
+  while (j < 2000) {
+    var garbage = [j, j, j];
+    j += 1;
+  }
+  i += 1;
+}
+print(made + count(kept));
+
+print(clock() - start);
@@ -0,0 +1,23 @@
+// Dispatches on small integers through match.
+var start = clock();
+
+var a = 0;
+var b = 0;
+var c = 0;
+var i = 0;
+while (i < 2000000) {
+  match (i % 8) {
+    case 0 => a += 1;
+    case 1 => b += 1;
+    case 2 => c += 1;
+    case 3 => a += 2;
+    case 4 => b += 2;
+    case 5 => c += 2;
+    case 6 => a -= 1;
+    else => b -= 1;
+  }
+  i += 1;
+}
+print(a + b + c);
+
+print(clock() - start);
@@ -0,0 +1,24 @@
+// Calls small struct methods in a tight loop.
+struct Counter {
+  var count = 0;
+
+  func add(n) {
+    self.count = self.count + n;
+    return self;
+  }
+
+  func get() => self.count;
+}
+
+var start = clock();
+
+var counter = Counter {};
+var i = 0;
+while (i < 2000000) {
+  counter.add(1).add(2);
+  counter.get();
+  i += 1;
+}
+print(counter.get());
+
+print(clock() - start);
@@ -0,0 +1,53 @@
+// Measures the cost of calling natives from script code.
+// The last line is the total time, for benchmark.py.
+var N = 2000000;
+
+var total = clock();
+
+func report(name, seconds) {
+  print(name .. "\t" .. toString(seconds * 1000000000 / N) .. " ns/call");
+}
+
+var start = clock();
+var i = 0;
+while (i < N) { i += 1; }
+var empty = clock() - start;
+
+start = clock();
+i = 0;
+while (i < N) { clock(); i += 1; }
+report("clock", clock() - start - empty);
+
+start = clock();
+i = 0;
+while (i < N) { toString(i); i += 1; }
+report("toString", clock() - start - empty);
+
+var arr = [];
+start = clock();
+i = 0;
+while (i < N) { arr.push(i); i += 1; }
+report("push", clock() - start - empty);
+
+start = clock();
+i = 0;
+while (i < N) { arr.len(); i += 1; }
+report("len", clock() - start - empty);
+
+start = clock();
+i = 0;
+while (i < N) { sqrt(i); i += 1; }
+report("sqrt", clock() - start - empty);
+
+func id(x) { return x; }
+start = clock();
+i = 0;
+while (i < N) { id(i); i += 1; }
+report("script func", clock() - start - empty);
+
+start = clock();
+i = 0;
+while (i < N) { print(); i += 1; }
+report("print", clock() - start - empty);
+
+print(clock() - total);
@@ -0,0 +1,22 @@
+// Reads and writes instance fields.
+struct Vec {
+  var x = 0;
+  var y = 0;
+  var z = 0;
+}
+
+var start = clock();
+
+var v = Vec { .x = 1, .y = 2, .z = 3 };
+var sum = 0;
+var i = 0;
+while (i < 3000000) {
+  v.x = v.y + 1;
+  v.y = v.z - 1;
+  v.z = v.x;
+  sum = sum + v.x + v.y + v.z;
+  i += 1;
+}
+print(sum > 0);
+
+print(clock() - start);
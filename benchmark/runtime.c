@@ -0,0 +1,284 @@
+// Times the runtime's hot primitives directly, without going through a
+// script: string tables, string interning and hashing, value array growth
+// and garbage collection over synthetic heaps. Each benchmark warms up,
+// then runs several times, and the fastest and median runs are reported per
+// operation. Build it with "make bench PROFILE=release".
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAS_CYCLES 1
+#else
+#define HAS_CYCLES 0
+#endif
+
+#include "hobbyscript.h"
+#include "memory.h"
+#include "object.h"
+#include "state.h"
+#include "table.h"
+
+#define REPEATS 7
+#define KEY_COUNT 1024
+
+struct Timer {
+  u64 ns;
+  u64 cycles;
+  u64 startNs;
+  u64 startCycles;
+};
+
+static u64 nowNs() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (u64)now.tv_sec * 1000000000u + (u64)now.tv_nsec;
+}
+
+static inline u64 nowCycles() {
+#if HAS_CYCLES
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+static inline void startTimer(struct Timer* timer) {
+  timer->startNs = nowNs();
+  timer->startCycles = nowCycles();
+}
+
+static inline void stopTimer(struct Timer* timer) {
+  timer->cycles += nowCycles() - timer->startCycles;
+  timer->ns += nowNs() - timer->startNs;
+}
+
+// Keeps results alive so the compiler can't drop the work.
+static volatile u64 sink;
+
+// Strings used as keys, kept reachable in an array on the stack.
+static struct GcString* keys[KEY_COUNT];
+static struct GcString* missingKeys[KEY_COUNT];
+
+static void makeKeys(struct hs_State* H) {
+  struct GcArray* holder = newArray(H);
+  push(H, NEW_OBJ(holder));
+  char name[32];
+  for (s32 i = 0; i < KEY_COUNT; i++) {
+    s32 length = snprintf(name, sizeof(name), "key%d", i);
+    keys[i] = copyString(H, name, length);
+    writeValueArray(H, &holder->values, NEW_OBJ(keys[i]));
+    length = snprintf(name, sizeof(name), "missing%d", i);
+    missingKeys[i] = copyString(H, name, length);
+    writeValueArray(H, &holder->values, NEW_OBJ(missingKeys[i]));
+  }
+}
+
+// Each benchmark does iterations operations, timing only the part that
+// matters.
+
+static void benchTableSet(struct hs_State* H, struct Timer* timer, s64 iterations) {
+  for (s64 done = 0; done < iterations; done += KEY_COUNT) {
+    struct Table table;
+    initTable(&table);
+    startTimer(timer);
+    for (s32 i = 0; i < KEY_COUNT; i++) {
+      tableSet(H, &table, keys[i], NEW_NUMBER(i));
+    }
+    stopTimer(timer);
+    freeTable(H, &table);
+  }
+}
+
+static struct Table filled;
+
+static void fillTable(struct hs_State* H) {
+  initTable(&filled);
+  for (s32 i = 0; i < KEY_COUNT; i++) {
+    tableSet(H, &filled, keys[i], NEW_NUMBER(i));
+  }
+}
+
+static void benchTableGetHit(UNUSED struct hs_State* H, struct Timer* timer, s64 iterations) {
+  Value value = NEW_NIL;
+  startTimer(timer);
+  for (s64 i = 0; i < iterations; i++) {
+    tableGet(&filled, keys[i & (KEY_COUNT - 1)], &value);
+  }
+  stopTimer(timer);
+  sink += (u64)AS_NUMBER(value);
+}
+
+static void benchTableGetMiss(UNUSED struct hs_State* H, struct Timer* timer, s64 iterations) {
+  Value value = NEW_NIL;
+  u64 found = 0;
+  startTimer(timer);
+  for (s64 i = 0; i < iterations; i++) {
+    found += tableGet(&filled, missingKeys[i & (KEY_COUNT - 1)], &value);
+  }
+  stopTimer(timer);
+  sink += found;
+}
+
+static char text[256];
+
+static void copyInterned(struct hs_State* H, struct Timer* timer, s64 iterations, s32 length) {
+  struct GcString* string = copyString(H, text, length);
+  push(H, NEW_OBJ(string));
+  startTimer(timer);
+  for (s64 i = 0; i < iterations; i++) {
+    string = copyString(H, text, length);
+  }
+  stopTimer(timer);
+  sink += string->hash;
+  pop(H);
+}
+
+static void benchCopyString8(struct hs_State* H, struct Timer* timer, s64 iterations) {
+  copyInterned(H, timer, iterations, 8);
+}
+
+static void benchCopyString128(struct hs_State* H, struct Timer* timer, s64 iterations) {
+  copyInterned(H, timer, iterations, 128);
+}
+
+static void benchHashString128(UNUSED struct hs_State* H, struct Timer* timer, s64 iterations) {
+  u32 hash = 0;
+  startTimer(timer);
+  for (s64 i = 0; i < iterations; i++) {
+    text[0] = (char)('a' + (i & 15));
+    hash += hashString(text, 128);
+  }
+  stopTimer(timer);
+  sink += hash;
+}
+
+#define ARRAY_LENGTH 1000
+
+static void benchWriteValueArray(struct hs_State* H, struct Timer* timer, s64 iterations) {
+  for (s64 done = 0; done < iterations; done += ARRAY_LENGTH) {
+    struct ValueArray array;
+    initValueArray(&array);
+    startTimer(timer);
+    for (s32 i = 0; i < ARRAY_LENGTH; i++) {
+      writeValueArray(H, &array, NEW_NUMBER(i));
+    }
+    stopTimer(timer);
+    freeValueArray(H, &array);
+  }
+}
+
+#define HEAP_ARRAYS 10000
+
+// Pushes an array of HEAP_ARRAYS small arrays, each holding numbers and a
+// string of its own: two objects per element.
+static void buildHeap(struct hs_State* H) {
+  struct GcArray* root = newArray(H);
+  push(H, NEW_OBJ(root));
+  char name[32];
+  for (s32 i = 0; i < HEAP_ARRAYS; i++) {
+    struct GcArray* element = newArray(H);
+    writeValueArray(H, &root->values, NEW_OBJ(element));
+    for (s32 j = 0; j < 4; j++) {
+      writeValueArray(H, &element->values, NEW_NUMBER(j));
+    }
+    s32 length = snprintf(name, sizeof(name), "element%d", i);
+    writeValueArray(H, &element->values, NEW_OBJ(copyString(H, name, length)));
+  }
+}
+
+// One operation is one collection that only finds live objects.
+static void benchCollectLive(struct hs_State* H, struct Timer* timer, s64 iterations) {
+  buildHeap(H);
+  for (s64 i = 0; i < iterations; i++) {
+    startTimer(timer);
+    collectGarbage(H);
+    stopTimer(timer);
+  }
+  pop(H);
+}
+
+// One operation is one collection that frees a heap's worth of garbage.
+static void benchCollectGarbage(struct hs_State* H, struct Timer* timer, s64 iterations) {
+  for (s64 i = 0; i < iterations; i++) {
+    buildHeap(H);
+    pop(H);
+    startTimer(timer);
+    collectGarbage(H);
+    stopTimer(timer);
+  }
+}
+
+struct Benchmark {
+  const char* name;
+  void (*run)(struct hs_State* H, struct Timer* timer, s64 iterations);
+  s64 iterations;
+};
+
+static const struct Benchmark benchmarks[] = {
+  {"tableSet (1024 keys, growing)", benchTableSet, 1 << 20},
+  {"tableGet hit", benchTableGetHit, 1 << 24},
+  {"tableGet miss", benchTableGetMiss, 1 << 24},
+  {"copyString interned, 8 bytes", benchCopyString8, 1 << 22},
+  {"copyString interned, 128 bytes", benchCopyString128, 1 << 21},
+  {"hashString 128 bytes", benchHashString128, 1 << 21},
+  {"writeValueArray (growing to 1000)", benchWriteValueArray, ARRAY_LENGTH * 4096},
+  {"collectGarbage, 20k live objects", benchCollectLive, 50},
+  {"collectGarbage, 20k dead objects", benchCollectGarbage, 20},
+  {NULL, NULL, 0},
+};
+
+static s32 compareTimers(const void* a, const void* b) {
+  u64 nsA = ((const struct Timer*)a)->ns;
+  u64 nsB = ((const struct Timer*)b)->ns;
+  return nsA < nsB ? -1 : nsA > nsB ? 1 : 0;
+}
+
+static void runBenchmark(struct hs_State* H, const struct Benchmark* benchmark) {
+  struct Timer warmup = {0};
+  benchmark->run(H, &warmup, benchmark->iterations / 10 > 0 ? benchmark->iterations / 10 : 1);
+
+  struct Timer timers[REPEATS];
+  for (s32 i = 0; i < REPEATS; i++) {
+    memset(&timers[i], 0, sizeof(struct Timer));
+    benchmark->run(H, &timers[i], benchmark->iterations);
+  }
+  qsort(timers, REPEATS, sizeof(struct Timer), compareTimers);
+
+  f64 iterations = (f64)benchmark->iterations;
+  printf("%-36s %12.2f %12.2f", benchmark->name,
+      (f64)timers[0].ns / iterations, (f64)timers[REPEATS / 2].ns / iterations);
+  if (HAS_CYCLES) {
+    printf(" %12.1f\n", (f64)timers[0].cycles / iterations);
+  } else {
+    printf(" %12s\n", "-");
+  }
+}
+
+s32 main(s32 argc, const char* args[]) {
+  struct hs_State* H = hs_newState();
+  memset(text, 'x', sizeof(text));
+  makeKeys(H);
+  fillTable(H);
+
+  printf("%-36s %12s %12s %12s\n", "benchmark", "best ns/op", "median ns/op", "cycles/op");
+  for (const struct Benchmark* benchmark = benchmarks; benchmark->name != NULL; benchmark++) {
+    // Only the benchmarks whose names contain an argument, if any are given.
+    bool selected = argc < 2;
+    for (s32 i = 1; i < argc; i++) {
+      selected = selected || strstr(benchmark->name, args[i]) != NULL;
+    }
+    if (selected) {
+      runBenchmark(H, benchmark);
+    }
+  }
+
+  freeTable(H, &filled);
+  hs_freeState(H);
+  return 0;
+}
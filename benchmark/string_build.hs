@@ -0,0 +1,18 @@
+// Builds strings by concatenation and number conversion.
+var start = clock();
+
+var total = 0;
+var round = 0;
+while (round < 200) {
+  var s = "";
+  var i = 0;
+  while (i < 500) {
+    s = s .. toString(i) .. ",";
+    i += 1;
+  }
+  total += 1;
+  round += 1;
+}
+print(total);
+
+print(clock() - start);
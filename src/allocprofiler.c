@@ -0,0 +1,341 @@
+#include "allocprofiler.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "state.h"
+
+// Attributes every allocation to the script call stack that made it. Each
+// distinct stack gets a record of the objects and bytes it allocated, and
+// every object is remembered (in a side table keyed by address) along with
+// its stack and the collection it was born after, so freeing it can tell
+// whether it outlived a collection. Temporaries that die young are what
+// drive collections, and show up with a low survival rate.
+
+#define STACK_DEPTH_MAX 64
+
+struct AllocationStack {
+  char* stack; // Folded, outermost frame first.
+  u32 hash;
+  u64 objects;
+  u64 bytes;
+  u64 survived;
+  u64 diedYoung;
+};
+
+struct TrackedObject {
+  struct GcObj* object; // NULL when empty, TOMBSTONE when deleted.
+  s32 stack;
+  u32 born;
+};
+
+#define TOMBSTONE ((struct GcObj*)1)
+
+struct AllocationProfiler {
+  struct AllocationStack* stacks;
+  s32 stackCount;
+  s32 stackCapacity;
+  // Open addressing over indices into stacks, -1 when empty.
+  s32* stackIndex;
+  s32 stackIndexCapacity;
+
+  struct TrackedObject* objects;
+  s32 objectCount; // Including tombstones.
+  s32 objectCapacity;
+
+  u32 collections;
+  // The stack of the latest growth, which an object allocation follows.
+  s32 lastStack;
+};
+
+static u32 hashBytes(const char* chars, size_t length) {
+  u32 hash = 2166136261u;
+  for (size_t i = 0; i < length; i++) {
+    hash ^= (u8)chars[i];
+    hash *= 16777619;
+  }
+  return hash;
+}
+
+static u32 hashPointer(struct GcObj* object) {
+  uintptr_t key = (uintptr_t)object;
+  key ^= key >> 33;
+  key *= 0xff51afd7ed558ccdull;
+  key ^= key >> 33;
+  return (u32)key;
+}
+
+static size_t foldStack(struct hs_State* H, char* buffer, size_t size) {
+  size_t length = 0;
+  buffer[0] = '\0';
+  s32 first = H->frameCount > STACK_DEPTH_MAX ? H->frameCount - STACK_DEPTH_MAX : 0;
+  for (s32 i = first; i < H->frameCount; i++) {
+    struct CallFrame* frame = &H->frames[i];
+    if (frame->func == NULL) { // C function
+      continue;
+    }
+    struct GcBcFunction* function = frame->func->function;
+    const char* name = function->name != NULL ? function->name->chars : "script";
+    s32 written = snprintf(buffer + length, size - length, "%s%s:%d",
+        length > 0 ? ";" : "", name, functionLine(function, frame->ip));
+    if (written < 0 || (size_t)written >= size - length) {
+      break;
+    }
+    length += (size_t)written;
+  }
+
+  if (length == 0) {
+    // The compiler, or the host calling the API outside of any script.
+    length = (size_t)snprintf(buffer, size, "[host]");
+  }
+  return length;
+}
+
+static void growStackIndex(struct AllocationProfiler* profiler) {
+  s32 capacity = profiler->stackIndexCapacity < 64 ? 64 : profiler->stackIndexCapacity * 2;
+  s32* index = malloc(sizeof(s32) * capacity);
+  for (s32 i = 0; i < capacity; i++) {
+    index[i] = -1;
+  }
+  for (s32 i = 0; i < profiler->stackCount; i++) {
+    u32 slot = profiler->stacks[i].hash & (capacity - 1);
+    while (index[slot] != -1) {
+      slot = (slot + 1) & (capacity - 1);
+    }
+    index[slot] = i;
+  }
+  free(profiler->stackIndex);
+  profiler->stackIndex = index;
+  profiler->stackIndexCapacity = capacity;
+}
+
+static s32 findStack(struct AllocationProfiler* profiler, const char* stack, size_t length) {
+  if ((profiler->stackCount + 1) * 4 > profiler->stackIndexCapacity * 3) {
+    growStackIndex(profiler);
+  }
+
+  u32 hash = hashBytes(stack, length);
+  u32 slot = hash & (profiler->stackIndexCapacity - 1);
+  while (profiler->stackIndex[slot] != -1) {
+    struct AllocationStack* existing = &profiler->stacks[profiler->stackIndex[slot]];
+    if (existing->hash == hash && strcmp(existing->stack, stack) == 0) {
+      return profiler->stackIndex[slot];
+    }
+    slot = (slot + 1) & (profiler->stackIndexCapacity - 1);
+  }
+
+  if (profiler->stackCount == profiler->stackCapacity) {
+    profiler->stackCapacity = profiler->stackCapacity < 64 ? 64 : profiler->stackCapacity * 2;
+    profiler->stacks = realloc(
+        profiler->stacks, sizeof(struct AllocationStack) * profiler->stackCapacity);
+  }
+  struct AllocationStack* added = &profiler->stacks[profiler->stackCount];
+  added->stack = malloc(length + 1);
+  memcpy(added->stack, stack, length + 1);
+  added->hash = hash;
+  added->objects = 0;
+  added->bytes = 0;
+  added->survived = 0;
+  added->diedYoung = 0;
+  profiler->stackIndex[slot] = profiler->stackCount;
+  return profiler->stackCount++;
+}
+
+static struct TrackedObject* findObject(
+    struct TrackedObject* objects, s32 capacity, struct GcObj* object) {
+  u32 slot = hashPointer(object) & (capacity - 1);
+  struct TrackedObject* tombstone = NULL;
+  while (true) {
+    struct TrackedObject* entry = &objects[slot];
+    if (entry->object == NULL) {
+      return tombstone != NULL ? tombstone : entry;
+    }
+    if (entry->object == TOMBSTONE) {
+      if (tombstone == NULL) {
+        tombstone = entry;
+      }
+    } else if (entry->object == object) {
+      return entry;
+    }
+    slot = (slot + 1) & (capacity - 1);
+  }
+}
+
+static void growObjects(struct AllocationProfiler* profiler) {
+  s32 capacity = profiler->objectCapacity < 1024 ? 1024 : profiler->objectCapacity * 2;
+  struct TrackedObject* objects = calloc(capacity, sizeof(struct TrackedObject));
+  s32 count = 0;
+  for (s32 i = 0; i < profiler->objectCapacity; i++) {
+    struct TrackedObject* entry = &profiler->objects[i];
+    if (entry->object == NULL || entry->object == TOMBSTONE) {
+      continue;
+    }
+    *findObject(objects, capacity, entry->object) = *entry;
+    count++;
+  }
+  free(profiler->objects);
+  profiler->objects = objects;
+  profiler->objectCapacity = capacity;
+  profiler->objectCount = count;
+}
+
+void profileGrowth(struct hs_State* H, size_t bytes) {
+  struct AllocationProfiler* profiler = H->allocationProfiler;
+  char buffer[4096];
+  size_t length = foldStack(H, buffer, sizeof(buffer));
+  s32 stack = findStack(profiler, buffer, length);
+  profiler->stacks[stack].bytes += bytes;
+  profiler->lastStack = stack;
+}
+
+void profileObject(struct hs_State* H, struct GcObj* object) {
+  struct AllocationProfiler* profiler = H->allocationProfiler;
+  profiler->stacks[profiler->lastStack].objects++;
+
+  if ((profiler->objectCount + 1) * 4 > profiler->objectCapacity * 3) {
+    growObjects(profiler);
+  }
+  struct TrackedObject* entry = findObject(profiler->objects, profiler->objectCapacity, object);
+  if (entry->object == NULL) {
+    profiler->objectCount++;
+  }
+  entry->object = object;
+  entry->stack = profiler->lastStack;
+  entry->born = profiler->collections;
+}
+
+void profileFree(struct hs_State* H, struct GcObj* object) {
+  struct AllocationProfiler* profiler = H->allocationProfiler;
+  if (profiler->objectCapacity == 0) {
+    return;
+  }
+
+  struct TrackedObject* entry = findObject(profiler->objects, profiler->objectCapacity, object);
+  // Objects from before the profiler started aren't tracked.
+  if (entry->object != object) {
+    return;
+  }
+  struct AllocationStack* stack = &profiler->stacks[entry->stack];
+  if (entry->born < profiler->collections) {
+    stack->survived++;
+  } else {
+    stack->diedYoung++;
+  }
+  entry->object = TOMBSTONE;
+}
+
+void profileCollection(struct hs_State* H) {
+  H->allocationProfiler->collections++;
+}
+
+bool hs_startAllocationProfiler(struct hs_State* H) {
+  if (H->allocationProfiler != NULL) {
+    return false;
+  }
+
+  struct AllocationProfiler* profiler = calloc(1, sizeof(struct AllocationProfiler));
+  H->allocationProfiler = profiler;
+  return true;
+}
+
+// The allocation site is the innermost frame of the stack.
+static const char* siteOf(const char* stack) {
+  const char* separator = strrchr(stack, ';');
+  return separator != NULL ? separator + 1 : stack;
+}
+
+static s32 compareSites(const void* a, const void* b) {
+  const struct AllocationStack* stackA = a;
+  const struct AllocationStack* stackB = b;
+  return strcmp(siteOf(stackA->stack), siteOf(stackB->stack));
+}
+
+static s32 compareBytes(const void* a, const void* b) {
+  u64 bytesA = ((const struct AllocationStack*)a)->bytes;
+  u64 bytesB = ((const struct AllocationStack*)b)->bytes;
+  return bytesA < bytesB ? 1 : bytesA > bytesB ? -1 : 0;
+}
+
+static void writeFolded(struct AllocationProfiler* profiler, FILE* out) {
+  for (s32 i = 0; i < profiler->stackCount; i++) {
+    struct AllocationStack* stack = &profiler->stacks[i];
+    if (stack->bytes > 0) {
+      fprintf(out, "%s %llu\n", stack->stack, (unsigned long long)stack->bytes);
+    }
+  }
+}
+
+// Merges the stacks by site and writes them, most bytes first. Reorders
+// the stacks, so it runs last.
+static void writeReport(struct AllocationProfiler* profiler, FILE* out) {
+  qsort(profiler->stacks, profiler->stackCount, sizeof(struct AllocationStack), compareSites);
+  s32 sites = 0;
+  for (s32 i = 0; i < profiler->stackCount; i++) {
+    struct AllocationStack* stack = &profiler->stacks[i];
+    if (sites > 0 && compareSites(&profiler->stacks[sites - 1], stack) == 0) {
+      struct AllocationStack* site = &profiler->stacks[sites - 1];
+      site->objects += stack->objects;
+      site->bytes += stack->bytes;
+      site->survived += stack->survived;
+      site->diedYoung += stack->diedYoung;
+      free(stack->stack);
+    } else {
+      profiler->stacks[sites++] = *stack;
+    }
+  }
+  profiler->stackCount = sites;
+  qsort(profiler->stacks, sites, sizeof(struct AllocationStack), compareBytes);
+
+  u64 totalBytes = 0;
+  for (s32 i = 0; i < sites; i++) {
+    totalBytes += profiler->stacks[i].bytes;
+  }
+
+  fprintf(out, "%-32s %10s %12s %7s %9s\n", "site", "objects", "bytes", "bytes%", "survived");
+  for (s32 i = 0; i < sites; i++) {
+    struct AllocationStack* site = &profiler->stacks[i];
+    u64 seen = site->survived + site->diedYoung;
+    fprintf(out, "%-32s %10llu %12llu %6.2f%%", siteOf(site->stack),
+        (unsigned long long)site->objects, (unsigned long long)site->bytes,
+        totalBytes == 0 ? 0 : 100.0 * (f64)site->bytes / (f64)totalBytes);
+    if (seen > 0) {
+      fprintf(out, " %8.2f%%\n", 100.0 * (f64)site->survived / (f64)seen);
+    } else {
+      fprintf(out, " %9s\n", "-");
+    }
+  }
+}
+
+void hs_stopAllocationProfiler(struct hs_State* H, FILE* report, FILE* folded) {
+  struct AllocationProfiler* profiler = H->allocationProfiler;
+  if (profiler == NULL) {
+    return;
+  }
+  H->allocationProfiler = NULL;
+
+  // Objects still alive count as survivors if they made it through a
+  // collection.
+  for (s32 i = 0; i < profiler->objectCapacity; i++) {
+    struct TrackedObject* entry = &profiler->objects[i];
+    if (entry->object != NULL && entry->object != TOMBSTONE
+        && entry->born < profiler->collections) {
+      profiler->stacks[entry->stack].survived++;
+    }
+  }
+
+  if (folded != NULL) {
+    writeFolded(profiler, folded);
+  }
+  if (report != NULL) {
+    writeReport(profiler, report);
+  }
+
+  for (s32 i = 0; i < profiler->stackCount; i++) {
+    free(profiler->stacks[i].stack);
+  }
+  free(profiler->stacks);
+  free(profiler->stackIndex);
+  free(profiler->objects);
+  free(profiler);
+}
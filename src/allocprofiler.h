@@ -0,0 +1,17 @@
+#ifndef _HOBBYSCRIPT_ALLOCPROFILER_H
+#define _HOBBYSCRIPT_ALLOCPROFILER_H
+
+#include "common.h"
+#include "hobbyscript.h"
+#include "object.h"
+
+struct AllocationProfiler;
+
+// Hooks for the memory manager, only called while the profiler runs.
+void profileGrowth(struct hs_State* H, size_t bytes);
+// Follows the growth that allocated the object.
+void profileObject(struct hs_State* H, struct GcObj* object);
+void profileFree(struct hs_State* H, struct GcObj* object);
+void profileCollection(struct hs_State* H);
+
+#endif // _HOBBYSCRIPT_ALLOCPROFILER_H
@@ -1,31 +1,579 @@
 #include "common.h"
 #include "hobbyscript.h"
+#include "memory.h"
 #include "modules.h"
 #include "object.h"
 #include "table.h"
-#include <stdio.h>
+#include "state.h"
+#include "vm.h"
 
-void array_push(struct hs_State* H, UNUSED s32 argCount) {
-  if (!hs_isArray(H, 0)) {
-    printf("Expected array.\n");
-    hs_pushNil(H);
-    return;
+#include <math.h>
+#include <string.h>
+
+// Below this many elements, introsort hands off to insertion sort.
+#define SORT_INSERTION_THRESHOLD 16
+
+// The elements an array or an array view covers. Views share their parent's
+// buffer, so this always points into a GcArray.
+struct ArrayRange {
+  struct GcArray* array;
+  s32 start;
+  s32 count;
+};
+
+static bool toRange(struct hs_State* H, Value value, struct ArrayRange* range) {
+  if (IS_ARRAY(value)) {
+    range->array = AS_ARRAY(value);
+    range->start = 0;
+    range->count = range->array->values.count;
+    return true;
+  }
+
+  if (IS_ARRAY_VIEW(value)) {
+    struct GcArrayView* view = AS_ARRAY_VIEW(value);
+    range->array = view->parent;
+    range->start = view->start;
+    range->count = arrayViewCount(view);
+    return true;
+  }
+
+  runtimeError(H, "Expected array.");
+  return false;
+}
+
+// Makes room for size values, if that stays within the memory limit. The
+// script picks the size, so it's checked before anything is allocated.
+static bool reserveValues(struct hs_State* H, struct ValueArray* values, double size) {
+  if (!(size <= VALUE_ARRAY_MAX)
+      || !reserveMemory(H, sizeof(Value) * (size_t)(size - values->capacity))) {
+    runtimeError(H, "Out of memory.");
+    return false;
+  }
+  reserveValueArray(H, values, (s32)size);
+  return true;
+}
+
+static Value* rangeValues(struct ArrayRange* range) {
+  return range->array->values.values + range->start;
+}
+
+// Methods that change the length only make sense on arrays that own their
+// storage.
+static bool checkResizable(struct hs_State* H, Value receiver) {
+  if (!IS_ARRAY(receiver)) {
+    runtimeError(H, "Cannot resize an array view.");
+    return false;
+  }
+  return true;
+}
+
+// Reads an index argument in [0, max]. It's range-checked as a number
+// first, since converting one past the s32 range is undefined.
+static bool toIndex(struct hs_State* H, Value arg, s32 max, s32* out) {
+  if (!IS_NUMBER(arg)) {
+    runtimeError(H, "Expected a number for the index.");
+    return false;
+  }
+
+  f64 number = AS_NUMBER(arg);
+  if (!isfinite(number) || number != floor(number)) {
+    runtimeError(H, "Expected an integer for the index.");
+    return false;
+  }
+  if (number < 0 || number > max) {
+    runtimeError(H, "Index %.17g is out of bounds.", number);
+    return false;
+  }
+
+  *out = (s32)number;
+  return true;
+}
+
+static Value array_push(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  if (!checkResizable(H, args[0])) {
+    return NEW_NIL;
+  }
+  writeValueArray(H, &AS_ARRAY(args[0])->values, args[1]);
+  return NEW_NIL;
+}
+
+static Value array_pop(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  if (!checkResizable(H, args[0])) {
+    return NEW_NIL;
+  }
+
+  struct GcArray* array = AS_ARRAY(args[0]);
+  if (array->values.count == 0) {
+    return NEW_NIL;
+  }
+
+  return array->values.values[--array->values.count];
+}
+
+static Value array_insert(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  if (!checkResizable(H, args[0])) {
+    return NEW_NIL;
+  }
+
+  struct GcArray* array = AS_ARRAY(args[0]);
+  s32 index;
+  if (!toIndex(H, args[1], array->values.count, &index)) {
+    return NEW_NIL;
+  }
+
+  // Grow by one, then shift the tail over in one move.
+  writeValueArray(H, &array->values, NEW_NIL);
+  Value* values = array->values.values;
+  memmove(
+      values + index + 1, values + index,
+      sizeof(Value) * (array->values.count - 1 - index));
+  values[index] = args[2];
+  return NEW_NIL;
+}
+
+static Value array_removeAt(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  if (!checkResizable(H, args[0])) {
+    return NEW_NIL;
+  }
+
+  struct GcArray* array = AS_ARRAY(args[0]);
+  s32 index;
+  if (!toIndex(H, args[1], array->values.count - 1, &index)) {
+    return NEW_NIL;
+  }
+
+  Value* values = array->values.values;
+  Value removed = values[index];
+  memmove(
+      values + index, values + index + 1,
+      sizeof(Value) * (array->values.count - 1 - index));
+  array->values.count--;
+  return removed;
+}
+
+static Value array_swapRemove(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  if (!checkResizable(H, args[0])) {
+    return NEW_NIL;
+  }
+
+  struct GcArray* array = AS_ARRAY(args[0]);
+  s32 index;
+  if (!toIndex(H, args[1], array->values.count - 1, &index)) {
+    return NEW_NIL;
+  }
+
+  Value* values = array->values.values;
+  Value removed = values[index];
+  values[index] = values[--array->values.count];
+  return removed;
+}
+
+// Narrows the range to the [start, end) arguments in bounds[0] and
+// bounds[1], clamped so end is never before start.
+static bool toSubRange(
+    struct hs_State* H, Value* bounds, struct ArrayRange* range) {
+  s32 start, end;
+  if (!toIndex(H, bounds[0], range->count, &start)
+      || !toIndex(H, bounds[1], range->count, &end)) {
+    return false;
+  }
+  if (end < start) {
+    end = start;
+  }
+
+  range->start += start;
+  range->count = end - start;
+  return true;
+}
+
+static Value array_slice(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  struct ArrayRange range;
+  if (!toRange(H, args[0], &range) || !toSubRange(H, args + 1, &range)) {
+    return NEW_NIL;
+  }
+
+  struct GcArray* slice = newArray(H);
+  push(H, NEW_OBJ(slice));
+  reserveValueArray(H, &slice->values, range.count);
+  memcpy(slice->values.values, rangeValues(&range), sizeof(Value) * range.count);
+  slice->values.count = range.count;
+  return NEW_OBJ(slice);
+}
+
+static Value array_view(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  struct ArrayRange range;
+  if (!toRange(H, args[0], &range) || !toSubRange(H, args + 1, &range)) {
+    return NEW_NIL;
+  }
+
+  return NEW_OBJ(newArrayView(H, range.array, range.start, range.count));
+}
+
+static Value array_concat(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  struct ArrayRange a, b;
+  if (!toRange(H, args[0], &a) || !toRange(H, args[1], &b)) {
+    return NEW_NIL;
+  }
+
+  struct GcArray* result = newArray(H);
+  push(H, NEW_OBJ(result));
+  if (!reserveValues(H, &result->values, (double)a.count + b.count)) {
+    return NEW_NIL;
+  }
+  memcpy(result->values.values, rangeValues(&a), sizeof(Value) * a.count);
+  memcpy(
+      result->values.values + a.count, rangeValues(&b), sizeof(Value) * b.count);
+  result->values.count = a.count + b.count;
+  return NEW_OBJ(result);
+}
+
+static s32 indexOf(struct ArrayRange* range, Value value) {
+  Value* values = rangeValues(range);
+  for (s32 i = 0; i < range->count; i++) {
+    if (valuesEqual(values[i], value)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+static Value array_indexOf(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  struct ArrayRange range;
+  if (!toRange(H, args[0], &range)) {
+    return NEW_NIL;
+  }
+  return NEW_NUMBER(indexOf(&range, args[1]));
+}
+
+static Value array_contains(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  struct ArrayRange range;
+  if (!toRange(H, args[0], &range)) {
+    return NEW_NIL;
+  }
+  return NEW_BOOL(indexOf(&range, args[1]) != -1);
+}
+
+static Value array_reverse(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  struct ArrayRange range;
+  if (!toRange(H, args[0], &range)) {
+    return NEW_NIL;
+  }
+
+  Value* values = rangeValues(&range);
+  for (s32 i = 0, j = range.count - 1; i < j; i++, j--) {
+    Value tmp = values[i];
+    values[i] = values[j];
+    values[j] = tmp;
+  }
+  return NEW_NIL;
+}
+
+static Value array_fill(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  struct ArrayRange range;
+  if (!toRange(H, args[0], &range)) {
+    return NEW_NIL;
   }
-  hs_push(H, 1); // Value
-  hs_pushArray(H, 0);
-  hs_pushNil(H);
+
+  Value* values = rangeValues(&range);
+  Value value = args[1];
+  for (s32 i = 0; i < range.count; i++) {
+    values[i] = value;
+  }
+  return NEW_NIL;
+}
+
+struct SortState {
+  struct hs_State* H;
+  struct GcArray* array;
+  s32 start;
+  s32 count;
+  s32 arrayCount;
+  bool hasComparator;
+  Value comparator;
+  bool failed;
+};
+
+// The comparator may reallocate the array, so elements are always read
+// through the array rather than a cached pointer.
+#define AT(sort, i) ((sort)->array->values.values[(sort)->start + (i)])
+
+static s32 compareStrings(struct GcString* a, struct GcString* b) {
+  s32 length = a->length < b->length ? a->length : b->length;
+  s32 result = memcmp(a->chars, b->chars, length);
+  if (result != 0) {
+    return result;
+  }
+  return a->length - b->length;
+}
+
+static bool lessThan(struct SortState* sort, Value a, Value b) {
+  if (sort->failed) {
+    return false;
+  }
+
+  struct hs_State* H = sort->H;
+  if (!sort->hasComparator) {
+    if (IS_NUMBER(a) && IS_NUMBER(b)) {
+      return AS_NUMBER(a) < AS_NUMBER(b);
+    }
+    if (IS_STRING(a) && IS_STRING(b)) {
+      return compareStrings(AS_STRING(a), AS_STRING(b)) < 0;
+    }
+
+    runtimeError(H, "Can only compare numbers or strings without a comparator.");
+    sort->failed = true;
+    return false;
+  }
+
+  push(H, sort->comparator);
+  push(H, a);
+  push(H, b);
+  if (!callFromC(H, 2)) {
+    sort->failed = true;
+    return false;
+  }
+  Value result = pop(H);
+
+  if (sort->array->values.count != sort->arrayCount) {
+    runtimeError(H, "Array was resized while sorting.");
+    sort->failed = true;
+    return false;
+  }
+
+  return !IS_NIL(result) && !(IS_BOOL(result) && !AS_BOOL(result));
+}
+
+static void swapElements(struct SortState* sort, s32 a, s32 b) {
+  Value tmp = AT(sort, a);
+  AT(sort, a) = AT(sort, b);
+  AT(sort, b) = tmp;
+}
+
+static void insertionSort(struct SortState* sort, s32 lo, s32 hi) {
+  for (s32 i = lo + 1; i < hi && !sort->failed; i++) {
+    Value value = AT(sort, i);
+    s32 j = i - 1;
+    while (j >= lo && lessThan(sort, value, AT(sort, j))) {
+      AT(sort, j + 1) = AT(sort, j);
+      j--;
+    }
+    AT(sort, j + 1) = value;
+  }
+}
+
+static void siftDown(struct SortState* sort, s32 lo, s32 root, s32 count) {
+  while (!sort->failed) {
+    s32 child = 2 * root + 1;
+    if (child >= count) {
+      return;
+    }
+    if (child + 1 < count
+        && lessThan(sort, AT(sort, lo + child), AT(sort, lo + child + 1))) {
+      child++;
+    }
+    if (!lessThan(sort, AT(sort, lo + root), AT(sort, lo + child))) {
+      return;
+    }
+    swapElements(sort, lo + root, lo + child);
+    root = child;
+  }
+}
+
+static void heapSort(struct SortState* sort, s32 lo, s32 hi) {
+  s32 count = hi - lo;
+  for (s32 i = count / 2 - 1; i >= 0; i--) {
+    siftDown(sort, lo, i, count);
+  }
+  for (s32 end = count - 1; end > 0 && !sort->failed; end--) {
+    swapElements(sort, lo, lo + end);
+    siftDown(sort, lo, 0, end);
+  }
+}
+
+// Hoare partition around a median-of-three pivot. Returns the split point;
+// everything before it is <= the pivot, everything from it on is >= it.
+static s32 partition(struct SortState* sort, s32 lo, s32 hi) {
+  s32 mid = lo + (hi - lo) / 2;
+  if (lessThan(sort, AT(sort, mid), AT(sort, lo))) {
+    swapElements(sort, lo, mid);
+  }
+  if (lessThan(sort, AT(sort, hi - 1), AT(sort, lo))) {
+    swapElements(sort, lo, hi - 1);
+  }
+  if (lessThan(sort, AT(sort, hi - 1), AT(sort, mid))) {
+    swapElements(sort, mid, hi - 1);
+  }
+
+  Value pivot = AT(sort, mid);
+  s32 i = lo - 1;
+  s32 j = hi;
+  while (true) {
+    // The bounds checks only matter for comparators that aren't consistent.
+    do {
+      i++;
+    } while (i < hi - 1 && lessThan(sort, AT(sort, i), pivot));
+    do {
+      j--;
+    } while (j > lo && lessThan(sort, pivot, AT(sort, j)));
+
+    if (i >= j) {
+      return j + 1;
+    }
+    swapElements(sort, i, j);
+  }
+}
+
+static void introsort(struct SortState* sort, s32 lo, s32 hi, s32 depth) {
+  while (hi - lo > SORT_INSERTION_THRESHOLD && !sort->failed) {
+    if (depth == 0) {
+      heapSort(sort, lo, hi);
+      return;
+    }
+    depth--;
+
+    s32 split = partition(sort, lo, hi);
+    introsort(sort, split, hi, depth);
+    hi = split;
+  }
+
+  insertionSort(sort, lo, hi);
+}
+
+static bool initSortState(
+    struct hs_State* H, struct SortState* sort,
+    Value* args, s32 argCount, s32 comparatorIndex) {
+  struct ArrayRange range;
+  if (!toRange(H, args[0], &range)) {
+    return false;
+  }
+
+  sort->H = H;
+  sort->array = range.array;
+  sort->start = range.start;
+  sort->count = range.count;
+  sort->arrayCount = range.array->values.count;
+  sort->hasComparator = argCount >= comparatorIndex;
+  sort->comparator = NEW_NIL;
+  sort->failed = false;
+
+  if (argCount > comparatorIndex) {
+    runtimeError(H, "Expected at most %d arguments, but got %d.",
+        comparatorIndex, argCount);
+    return false;
+  }
+
+  if (sort->hasComparator) {
+    sort->comparator = args[comparatorIndex];
+  }
+  return true;
+}
+
+static Value array_sort(struct hs_State* H, Value* args, s32 argCount) {
+  struct SortState sort;
+  if (!initSortState(H, &sort, args, argCount, 1)) {
+    return NEW_NIL;
+  }
+
+  s32 depth = 0;
+  for (s32 n = sort.count; n > 1; n >>= 1) {
+    depth += 2;
+  }
+
+  introsort(&sort, 0, sort.count, depth);
+  return NEW_NIL;
+}
+
+static Value array_binarySearch(struct hs_State* H, Value* args, s32 argCount) {
+  if (argCount < 1) {
+    runtimeError(H, "Expected at least 1 argument, but got %d.", argCount);
+    return NEW_NIL;
+  }
+
+  struct SortState sort;
+  if (!initSortState(H, &sort, args, argCount, 2)) {
+    return NEW_NIL;
+  }
+  Value value = args[1];
+
+  s32 lo = 0;
+  s32 hi = sort.count;
+  while (lo < hi) {
+    s32 mid = lo + (hi - lo) / 2;
+    if (lessThan(&sort, AT(&sort, mid), value)) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (sort.failed) {
+    return NEW_NIL;
+  }
+
+  bool found = lo < sort.count && !lessThan(&sort, value, AT(&sort, lo));
+  if (sort.failed) {
+    return NEW_NIL;
+  }
+  return NEW_NUMBER(found ? lo : -1);
 }
 
-struct hs_FuncInfo array[] = {
+#undef AT
+
+static Value array_reserve(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  if (!checkResizable(H, args[0])) {
+    return NEW_NIL;
+  }
+
+  struct GcArray* array = AS_ARRAY(args[0]);
+  if (!IS_NUMBER(args[1])) {
+    runtimeError(H, "Expected a number.");
+    return NEW_NIL;
+  }
+
+  double size = AS_NUMBER(args[1]);
+  if (size > array->values.capacity) {
+    reserveValues(H, &array->values, size);
+  }
+  return NEW_NIL;
+}
+
+static Value array_clear(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  if (!checkResizable(H, args[0])) {
+    return NEW_NIL;
+  }
+
+  AS_ARRAY(args[0])->values.count = 0;
+  return NEW_NIL;
+}
+
+static Value array_len(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  struct ArrayRange range;
+  if (!toRange(H, args[0], &range)) {
+    return NEW_NIL;
+  }
+  return NEW_NUMBER(range.count);
+}
+
+static const struct NativeInfo array[] = {
   {array_push, "push", 1},
+  {array_pop, "pop", 0},
+  {array_insert, "insert", 2},
+  {array_removeAt, "removeAt", 1},
+  {array_swapRemove, "swapRemove", 1},
+  {array_slice, "slice", 2},
+  {array_view, "view", 2},
+  {array_concat, "concat", 1},
+  {array_indexOf, "indexOf", 1},
+  {array_contains, "contains", 1},
+  {array_reverse, "reverse", 0},
+  {array_fill, "fill", 1},
+  {array_sort, "sort", -1},
+  {array_binarySearch, "binarySearch", -1},
+  {array_reserve, "reserve", 1},
+  {array_clear, "clear", 0},
+  {array_len, "len", 0},
   {NULL, NULL, -1},
 };
 
 void openArray(struct hs_State* H) {
-  for (struct hs_FuncInfo* info = array; info->func != NULL; info++) {
-    tableSet(
-        H, &H->arrayMethods,
-        copyString(H, info->name, strlen(info->name)),
-        NEW_OBJ(newCFunction(H, info->func, info->argCount)));
-  }
+  registerNatives(H, &H->arrayMethods, array);
 }
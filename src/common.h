@@ -11,9 +11,14 @@
 // #define DEBUG_STRESS_GC
 // #define DEBUG_LOG_GC
 
+// See opstats.h.
+// #define DEBUG_OPCODE_STATS
+// #define DEBUG_OPCODE_CYCLES
+
 #define NAN_BOXING
 
 #define UNUSED __attribute__((unused))
+#define NOINLINE __attribute__((noinline))
 #define FALLTHROUGH __attribute__((fallthrough))
 
 #define U8_COUNT (UINT8_MAX + 1)
@@ -11,6 +11,8 @@
 #include "tokenizer.h"
 #include "object.h"
 #include "memory.h"
+#include "state.h"
+#include "tracer.h"
 
 #ifdef DEBUG_PRINT_CODE
 #include "debug.h"
@@ -48,16 +50,17 @@ static void errorAt(struct Parser* parser, struct Token* token, const char* mess
     return;
   }
   parser->panicMode = true;
+  FILE* err = parser->H->err;
 
-  fprintf(stderr, "[line %d] Error", token->line);
+  fprintf(err, "[line %d] Error", token->line);
 
   if (token->type == TOKEN_EOF) {
-    fprintf(stderr, " at end");
+    fprintf(err, " at end");
   } else if (token->type != TOKEN_ERROR) {
-    fprintf(stderr, " at '%.*s'", token->length, token->start);
+    fprintf(err, " at '%.*s'", token->length, token->start);
   }
 
-  fprintf(stderr, ": %s\n", message);
+  fprintf(err, ": %s\n", message);
   parser->hadError = true;
 }
 
@@ -112,52 +115,253 @@ static void emitBytes(struct Parser* parser, u8 byte1, u8 byte2) {
   emitByte(parser, byte2);
 }
 
+// How many values each instruction pushes, less the ones it pops. The ones
+// taking a count of values (BC_ARRAY, BC_CALL, BC_INVOKE and BC_RESUME) are
+// adjusted where they're emitted.
+static const s8 stackEffects[] = {
+  [BC_CONSTANT]             = 1,
+  [BC_CONSTANT_LONG]        = 1,
+  [BC_NIL]                  = 1,
+  [BC_TRUE]                 = 1,
+  [BC_FALSE]                = 1,
+  [BC_POP]                  = -1,
+  [BC_ARRAY]                = 0,
+  [BC_ARRAY_LONG]           = 0,
+  [BC_ARRAY_CONSTANT]       = 1,
+  [BC_ARRAY_CONSTANT_LONG]  = 1,
+  [BC_GET_SUBSCRIPT]        = -1,
+  [BC_SET_SUBSCRIPT]        = -2,
+  [BC_DEFINE_GLOBAL]        = -1,
+  [BC_DEFINE_GLOBAL_LONG]   = -1,
+  [BC_GET_GLOBAL]           = 1,
+  [BC_GET_GLOBAL_LONG]      = 1,
+  [BC_SET_GLOBAL]           = 0,
+  [BC_SET_GLOBAL_LONG]      = 0,
+  [BC_GET_UPVALUE]          = 1,
+  [BC_SET_UPVALUE]          = 0,
+  [BC_GET_LOCAL]            = 1,
+  [BC_GET_LOCAL_LONG]       = 1,
+  [BC_SET_LOCAL]            = 0,
+  [BC_SET_LOCAL_LONG]       = 0,
+  [BC_INIT_PROPERTY]        = -1,
+  [BC_INIT_PROPERTY_LONG]   = -1,
+  [BC_GET_STATIC]           = 0,
+  [BC_GET_STATIC_LONG]      = 0,
+  [BC_PUSH_PROPERTY]        = 1,
+  [BC_PUSH_PROPERTY_LONG]   = 1,
+  [BC_GET_PROPERTY]         = 0,
+  [BC_GET_PROPERTY_LONG]    = 0,
+  [BC_SET_PROPERTY]         = -1,
+  [BC_SET_PROPERTY_LONG]    = -1,
+  [BC_DESTRUCT_ARRAY]       = 1,
+  [BC_EQUAL]                = -1,
+  [BC_NOT_EQUAL]            = -1,
+  [BC_GREATER]              = -1,
+  [BC_GREATER_EQUAL]        = -1,
+  [BC_LESSER]               = -1,
+  [BC_LESSER_EQUAL]         = -1,
+  [BC_CONCAT]               = -1,
+  [BC_ADD]                  = -1,
+  [BC_SUBTRACT]             = -1,
+  [BC_MULTIPLY]             = -1,
+  [BC_DIVIDE]               = -1,
+  [BC_MODULO]               = -1,
+  [BC_POW]                  = -1,
+  [BC_NEGATE]               = 0,
+  [BC_NOT]                  = 0,
+  [BC_JUMP]                 = 0,
+  [BC_JUMP_LONG]            = 0,
+  [BC_JUMP_IF_FALSE]        = 0,
+  [BC_JUMP_IF_FALSE_LONG]   = 0,
+  [BC_INEQUALITY_JUMP]      = -1,
+  [BC_INEQUALITY_JUMP_LONG] = -1,
+  [BC_LOOP]                 = 0,
+  [BC_LOOP_LONG]            = 0,
+  [BC_FOR_PREP]             = 0,
+  [BC_FOR_PREP_LONG]        = 0,
+  [BC_FOR_ITER]             = 0,
+  [BC_FOR_ITER_LONG]        = 0,
+  [BC_CALL]                 = 0,
+  [BC_INSTANCE]             = 0,
+  [BC_CLOSURE]              = 1,
+  [BC_CLOSURE_LONG]         = 1,
+  [BC_CLOSE_UPVALUE]        = -1,
+  [BC_RETURN]               = -1,
+  [BC_ENUM]                 = 1,
+  [BC_ENUM_LONG]            = 1,
+  [BC_ENUM_VALUE]           = 0,
+  [BC_ENUM_VALUE_LONG]      = 0,
+  [BC_STRUCT]               = 1,
+  [BC_STRUCT_LONG]          = 1,
+  [BC_STRUCT_FIELD]         = -1,
+  [BC_STRUCT_FIELD_LONG]    = -1,
+  [BC_METHOD]               = -1,
+  [BC_METHOD_LONG]          = -1,
+  [BC_STATIC_METHOD]        = -1,
+  [BC_STATIC_METHOD_LONG]   = -1,
+  [BC_INVOKE]               = 0,
+  [BC_INVOKE_LONG]          = 0,
+  [BC_YIELD]                = 0,
+  [BC_RESUME]               = 0,
+  [BC_BREAK]                = 0,
+};
+
+// Keeps count of the values on the stack as code is emitted, and of the most
+// there are at once, which calls make room for.
+static void adjustSlots(struct Parser* parser, s32 delta) {
+  struct Compiler* compiler = parser->compiler;
+  compiler->slotCount += delta;
+  if (compiler->slotCount > compiler->function->maxSlots) {
+    compiler->function->maxSlots = compiler->slotCount;
+  }
+}
+
+static void emitOp(struct Parser* parser, u8 instruction) {
+  emitByte(parser, instruction);
+  adjustSlots(parser, stackEffects[instruction]);
+}
+
+// The variant of an instruction taking a wider operand.
+static u8 longOpcode(u8 instruction) {
+  switch (instruction) {
+    case BC_CONSTANT: return BC_CONSTANT_LONG;
+    case BC_ARRAY_CONSTANT: return BC_ARRAY_CONSTANT_LONG;
+    case BC_DEFINE_GLOBAL: return BC_DEFINE_GLOBAL_LONG;
+    case BC_GET_GLOBAL: return BC_GET_GLOBAL_LONG;
+    case BC_SET_GLOBAL: return BC_SET_GLOBAL_LONG;
+    case BC_GET_LOCAL: return BC_GET_LOCAL_LONG;
+    case BC_SET_LOCAL: return BC_SET_LOCAL_LONG;
+    case BC_JUMP: return BC_JUMP_LONG;
+    case BC_JUMP_IF_FALSE: return BC_JUMP_IF_FALSE_LONG;
+    case BC_INEQUALITY_JUMP: return BC_INEQUALITY_JUMP_LONG;
+    case BC_LOOP: return BC_LOOP_LONG;
+    case BC_FOR_PREP: return BC_FOR_PREP_LONG;
+    case BC_FOR_ITER: return BC_FOR_ITER_LONG;
+    case BC_CLOSURE: return BC_CLOSURE_LONG;
+    case BC_INIT_PROPERTY: return BC_INIT_PROPERTY_LONG;
+    case BC_GET_STATIC: return BC_GET_STATIC_LONG;
+    case BC_PUSH_PROPERTY: return BC_PUSH_PROPERTY_LONG;
+    case BC_GET_PROPERTY: return BC_GET_PROPERTY_LONG;
+    case BC_SET_PROPERTY: return BC_SET_PROPERTY_LONG;
+    case BC_ENUM: return BC_ENUM_LONG;
+    case BC_ENUM_VALUE: return BC_ENUM_VALUE_LONG;
+    case BC_STRUCT: return BC_STRUCT_LONG;
+    case BC_STRUCT_FIELD: return BC_STRUCT_FIELD_LONG;
+    case BC_METHOD: return BC_METHOD_LONG;
+    case BC_STATIC_METHOD: return BC_STATIC_METHOD_LONG;
+    case BC_INVOKE: return BC_INVOKE_LONG;
+    default: return instruction; // BC_BREAK is patched into a jump later.
+  }
+}
+
+// Emits an instruction taking a constant, name, global or local index,
+// using its long variant if the index doesn't fit in a byte.
+static void emitIndexed(struct Parser* parser, u8 instruction, s32 index) {
+  if (index <= UINT8_MAX) {
+    emitBytes(parser, instruction, (u8)index);
+  } else {
+    emitByte(parser, longOpcode(instruction));
+    emitBytes(parser, (index >> 8) & 0xff, index & 0xff);
+  }
+  adjustSlots(parser, stackEffects[instruction]);
+}
+
+#define LONG_JUMP_MAX 0xffffff
+
 static s32 emitJump(struct Parser* parser, u8 byte) {
+  adjustSlots(parser, stackEffects[byte]);
+  if (parser->compiler->longJumps) {
+    emitByte(parser, longOpcode(byte));
+    emitByte(parser, 0xff);
+    emitBytes(parser, 0xff, 0xff);
+    return currentFunction(parser)->bcCount - 3;
+  }
+
   emitByte(parser, byte);
   emitByte(parser, 0xff);
   emitByte(parser, 0xff);
   return currentFunction(parser)->bcCount - 2;
 }
 
-static void patchJump(struct Parser* parser, s32 offset) {
+static void patchJumpOperand(struct Parser* parser, s32 offset, bool isLong) {
+  u8* bc = currentFunction(parser)->bc;
+  if (isLong) {
+    s32 jump = currentFunction(parser)->bcCount - offset - 3;
+    if (jump > LONG_JUMP_MAX) {
+      error(parser, "Too much code to jump over. Why?");
+    }
+
+    bc[offset] = (jump >> 16) & 0xff;
+    bc[offset + 1] = (jump >> 8) & 0xff;
+    bc[offset + 2] = jump & 0xff;
+    return;
+  }
+
   s32 jump = currentFunction(parser)->bcCount - offset - 2;
-  if (jump >= UINT16_MAX) {
-    error(parser, "Too much code to jump over. Why?");
+  if (jump > UINT16_MAX) {
+    // The function gets compiled again with long jumps.
+    parser->compiler->jumpTooLong = true;
+    return;
   }
 
-  currentFunction(parser)->bc[offset] = (jump >> 8) & 0xff;
-  currentFunction(parser)->bc[offset + 1] = jump & 0xff;
+  bc[offset] = (jump >> 8) & 0xff;
+  bc[offset + 1] = jump & 0xff;
 }
 
+static void patchJump(struct Parser* parser, s32 offset) {
+  patchJumpOperand(parser, offset, parser->compiler->longJumps);
+}
+
+// Loops jump backward to code that's already emitted, so they're only long
+// when they have to be.
 static void emitLoop(struct Parser* parser, s32 loopStart) {
-  emitByte(parser, BC_LOOP);
+  s32 offset = currentFunction(parser)->bcCount - loopStart + 3;
+  if (offset <= UINT16_MAX) {
+    emitByte(parser, BC_LOOP);
+    emitBytes(parser, (offset >> 8) & 0xff, offset & 0xff);
+    return;
+  }
 
-  s32 offset = currentFunction(parser)->bcCount - loopStart + 2;
-  if (offset > UINT16_MAX) {
+  offset++;
+  if (offset > LONG_JUMP_MAX) {
     error(parser, "Loop is too big. I'm not quite sure why you made a loop this big.");
   }
 
-  emitByte(parser, (offset >> 8) & 0xff);
-  emitByte(parser, offset & 0xff);
+  emitByte(parser, BC_LOOP_LONG);
+  emitByte(parser, (offset >> 16) & 0xff);
+  emitBytes(parser, (offset >> 8) & 0xff, offset & 0xff);
 }
 
 static void emitReturn(struct Parser* parser) {
-  emitByte(parser, BC_NIL);
-  emitByte(parser, BC_RETURN);
+  emitOp(parser, BC_NIL);
+  emitOp(parser, BC_RETURN);
 }
 
-static u8 makeConstant(struct Parser* parser, Value value) {
+static s32 makeConstant(struct Parser* parser, Value value) {
   s32 constant = addFunctionConstant(parser->H, currentFunction(parser), value);
-  if (constant > UINT8_MAX) {
+  if (constant > UINT16_MAX) {
     error(parser, "Too many constants in the global scope or functions.");
     return 0;
   }
 
-  return (u8)constant;
+  return constant;
 }
 
 static void emitConstant(struct Parser* parser, Value value) {
-  emitBytes(parser, BC_CONSTANT, makeConstant(parser, value));
+  emitIndexed(parser, BC_CONSTANT, makeConstant(parser, value));
+}
+
+static struct Local* pushLocal(struct Parser* parser) {
+  struct Compiler* compiler = parser->compiler;
+  if (compiler->localCount == compiler->localCapacity) {
+    s32 oldCapacity = compiler->localCapacity;
+    compiler->localCapacity = GROW_CAPACITY(oldCapacity);
+    compiler->locals = GROW_ARRAY(parser->H, struct Local, compiler->locals,
+        oldCapacity, compiler->localCapacity);
+  }
+
+  compiler->localCount++;
+  return &compiler->locals[compiler->localCount - 1];
 }
 
 static void initCompiler(struct Parser* parser,
@@ -169,8 +373,13 @@ static void initCompiler(struct Parser* parser,
   compiler->type = type;
 
   compiler->localOffset = 0;
+  compiler->locals = NULL;
+  compiler->localCapacity = 0;
   compiler->localCount = 0;
   compiler->scopeDepth = 0;
+  compiler->slotCount = 0;
+  compiler->longJumps = false;
+  compiler->jumpTooLong = false;
   compiler->function = newBcFunction(parser->H);
   compiler->loop = NULL;
   parser->compiler = compiler;
@@ -185,8 +394,8 @@ static void initCompiler(struct Parser* parser,
     }
   }
 
-  struct Local* local = 
-      &parser->compiler->locals[parser->compiler->localCount++];
+  struct Local* local = pushLocal(parser);
+  adjustSlots(parser, 1);
   local->depth = 0;
   local->isCaptured = false;
   if (type != FUNCTION_TYPE_FUNCTION) {
@@ -201,9 +410,10 @@ static void initCompiler(struct Parser* parser,
 static struct GcBcFunction* endCompiler(struct Parser* parser) {
   emitReturn(parser);
   struct GcBcFunction* function = parser->compiler->function;
+  FREE_ARRAY(parser->H, struct Local, parser->compiler->locals, parser->compiler->localCapacity);
 
 #ifdef DEBUG_PRINT_CODE
-  if (!parser->hadError) {
+  if (!parser->hadError && !parser->compiler->jumpTooLong) {
     disassembleFunction(
         parser->H, parser->compiler->function,
         function, function->name != NULL ? function->name->chars : "<script>");
@@ -214,6 +424,8 @@ static struct GcBcFunction* endCompiler(struct Parser* parser) {
   return function;
 }
 
+// Emits the code dropping locals deeper than toScope, leaving the slot count
+// alone: break and continue jump away with the locals still counted.
 static s32 discardLocals(struct Parser* parser, s32 toScope) {
   s32 discarded = 0;
   while (parser->compiler->localCount - discarded > 0
@@ -245,7 +457,8 @@ static void endLoop(struct Parser* parser, struct Loop* loop) {
 
   for (s32 i = 0; i < loop->breakCount; i++) {
     s32 breakIndex = loop->breakIndices[i];
-    currentFunction(parser)->bc[breakIndex] = BC_JUMP;
+    currentFunction(parser)->bc[breakIndex] =
+        parser->compiler->longJumps ? BC_JUMP_LONG : BC_JUMP;
     patchJump(parser, breakIndex + 1);
   }
 
@@ -284,13 +497,14 @@ static void endScope(struct Parser* parser) {
   parser->compiler->scopeDepth--;
   s32 discarded = discardLocals(parser, parser->compiler->scopeDepth);
   parser->compiler->localCount -= discarded;
+  adjustSlots(parser, -discarded);
 }
 
 static void synchronize(struct Parser* parser);
 static void expression(struct Parser* parser);
 static void statement(struct Parser* parser);
 static void declaration(struct Parser* parser);
-static struct ParseRule* getRule(enum TokenType type);
+static const struct ParseRule* getRule(enum TokenType type);
 static void parsePrecedence(struct Parser* parser, enum Precedence precedence);
 static void block(struct Parser* parser);
 
@@ -303,16 +517,16 @@ static void markInitialized(struct Parser* parser, bool isGlobal) {
       = parser->compiler->scopeDepth;
 }
 
-static void defineVariable(struct Parser* parser, u8 global, bool isGlobal) {
+static void defineVariable(struct Parser* parser, s32 global, bool isGlobal) {
   if (!isGlobal) {
     markInitialized(parser, isGlobal);
     return;
   }
 
-  emitBytes(parser, BC_DEFINE_GLOBAL, global);
+  emitIndexed(parser, BC_DEFINE_GLOBAL, global);
 }
 
-static u8 identifierConstant(struct Parser* parser, struct Token* name) {
+static s32 identifierConstant(struct Parser* parser, struct Token* name) {
   return makeConstant(parser, NEW_OBJ(copyString(parser->H, name->start, name->length)));
 }
 
@@ -331,7 +545,7 @@ static s32 resolveLocal(
   return -1;
 }
 
-static s32 addUpvalue(struct Parser* parser, struct Compiler* compiler, u8 index, bool isLocal) {
+static s32 addUpvalue(struct Parser* parser, struct Compiler* compiler, u16 index, bool isLocal) {
   u8 upvalueCount = compiler->function->upvalueCount;
 
   for (s32 i = 0; i < upvalueCount; i++) {
@@ -359,33 +573,43 @@ static s32 resolveUpvalue(struct Parser* parser, struct Compiler* compiler, stru
   s32 local = resolveLocal(parser, compiler->enclosing, name);
   if (local != -1) {
     compiler->enclosing->locals[local].isCaptured = true;
-    return addUpvalue(parser, compiler, (u8)local, true);
+    return addUpvalue(parser, compiler, (u16)local, true);
   }
 
   s32 upvalue = resolveUpvalue(parser, compiler->enclosing, name);
   if (upvalue != -1) {
-    return addUpvalue(parser, compiler, (u8)upvalue, false);
+    return addUpvalue(parser, compiler, (u16)upvalue, false);
   }
 
   return -1;
 }
 
 static void addLocal(struct Parser* parser, struct Token name) {
-  if (parser->compiler->localCount == U8_COUNT) {
+  if (parser->compiler->localCount == LOCALS_MAX) {
     error(parser, "Too many local variables in function.");
     return;
   }
 
   // s32 offset = parser->compiler->localOffset;
-  struct Local* local = 
-      &parser->compiler->locals[parser->compiler->localCount];
-  parser->compiler->localCount++;
+  struct Local* local = pushLocal(parser);
   local->name = name;
   local->isCaptured = false;
   local->depth = -1;
   local->depth = parser->compiler->scopeDepth;
 }
 
+// Adds a local the script can't name, for state the compiler keeps on the
+// stack.
+static void addHiddenLocal(struct Parser* parser, const char* name) {
+  struct Token token;
+  token.type = TOKEN_IDENTIFIER;
+  token.start = name;
+  token.length = (s32)strlen(name);
+  token.line = parser->previous.line;
+  token.value = NEW_NIL;
+  addLocal(parser, token);
+}
+
 static void declareVariable(struct Parser* parser, bool isGlobal) {
   if (isGlobal) {
     return;
@@ -407,7 +631,7 @@ static void declareVariable(struct Parser* parser, bool isGlobal) {
   addLocal(parser, *name);
 }
 
-static u8 parseVariable(struct Parser* parser, bool isGlobal, const char* errorMessage) {
+static s32 parseVariable(struct Parser* parser, bool isGlobal, const char* errorMessage) {
   consume(parser, TOKEN_IDENTIFIER, errorMessage);
 
   declareVariable(parser, isGlobal);
@@ -450,15 +674,15 @@ static void namedVariable(struct Parser* parser, struct Token name, bool canAssi
 
 #define COMPOUND_ASSIGNMENT(operator) \
     do { \
-      emitBytes(parser, getter, (u8)arg); \
+      emitIndexed(parser, getter, arg); \
       expression(parser); \
-      emitByte(parser, operator); \
-      emitBytes(parser, setter, (u8)arg); \
+      emitOp(parser, operator); \
+      emitIndexed(parser, setter, arg); \
     } while (false)
 
   if (canAssign && match(parser, TOKEN_EQUAL)) {
     expression(parser);
-    emitBytes(parser, setter, (u8)arg);
+    emitIndexed(parser, setter, arg);
   } else if (canAssign && match(parser, TOKEN_PLUS_EQUAL)) {
     COMPOUND_ASSIGNMENT(BC_ADD);
   } else if (canAssign && match(parser, TOKEN_MINUS_EQUAL)) {
@@ -474,7 +698,7 @@ static void namedVariable(struct Parser* parser, struct Token name, bool canAssi
   } else if (canAssign && match(parser, TOKEN_DOT_DOT_EQUAL)) {
     COMPOUND_ASSIGNMENT(BC_CONCAT);
   } else {
-    emitBytes(parser, getter, (u8)arg);
+    emitIndexed(parser, getter, arg);
   }
 #undef COMPOUND_ASSIGNMENT
 }
@@ -483,7 +707,7 @@ static void variable(struct Parser* parser, UNUSED bool canAssign) {
   struct Token name = parser->previous;
   if (match(parser, TOKEN_LBRACE)) { // Struct initalization
     namedVariable(parser, name, canAssign);
-    emitByte(parser, BC_INSTANCE);
+    emitOp(parser, BC_INSTANCE);
 
     if (check(parser, TOKEN_DOT)) {
       do {
@@ -493,7 +717,7 @@ static void variable(struct Parser* parser, UNUSED bool canAssign) {
         consume(parser, TOKEN_EQUAL, "Expected '=' after identifier.");
         expression(parser);
 
-        emitBytes(parser, BC_INIT_PROPERTY, identifierConstant(parser, &name));
+        emitIndexed(parser, BC_INIT_PROPERTY, identifierConstant(parser, &name));
 
         if (!match(parser, TOKEN_COMMA) && !check(parser, TOKEN_RBRACE)) {
           error(parser, "Expected ','.");
@@ -522,31 +746,31 @@ static void unary(struct Parser* parser, UNUSED bool canAssign) {
   parsePrecedence(parser, PREC_UNARY);
 
   switch (op) {
-    case TOKEN_MINUS: emitByte(parser, BC_NEGATE); break;
-    case TOKEN_BANG:  emitByte(parser, BC_NOT); break;
+    case TOKEN_MINUS: emitOp(parser, BC_NEGATE); break;
+    case TOKEN_BANG:  emitOp(parser, BC_NOT); break;
     default: return;
   }
 }
 
 static void binary(struct Parser* parser, UNUSED bool canAssign) {
   enum TokenType op = parser->previous.type;
-  struct ParseRule* rule = getRule(op);
+  const struct ParseRule* rule = getRule(op);
   parsePrecedence(parser, (enum Precedence)(rule->precedence + 1));
 
   switch (op) {
-    case TOKEN_PLUS:          emitByte(parser, BC_ADD); break;
-    case TOKEN_MINUS:         emitByte(parser, BC_SUBTRACT); break;
-    case TOKEN_STAR:          emitByte(parser, BC_MULTIPLY); break;
-    case TOKEN_SLASH:         emitByte(parser, BC_DIVIDE); break;
-    case TOKEN_PERCENT:       emitByte(parser, BC_MODULO); break;
-    case TOKEN_DOT_DOT:       emitByte(parser, BC_CONCAT); break;
-    case TOKEN_STAR_STAR:     emitByte(parser, BC_POW); break;
-    case TOKEN_EQUAL_EQUAL:   emitByte(parser, BC_EQUAL); break;
-    case TOKEN_BANG_EQUAL:    emitByte(parser, BC_NOT_EQUAL); break;
-    case TOKEN_GREATER:       emitByte(parser, BC_GREATER); break;
-    case TOKEN_LESS:          emitByte(parser, BC_LESSER); break;
-    case TOKEN_GREATER_EQUAL: emitByte(parser, BC_GREATER_EQUAL); break;
-    case TOKEN_LESS_EQUAL:    emitByte(parser, BC_LESSER_EQUAL); break;
+    case TOKEN_PLUS:          emitOp(parser, BC_ADD); break;
+    case TOKEN_MINUS:         emitOp(parser, BC_SUBTRACT); break;
+    case TOKEN_STAR:          emitOp(parser, BC_MULTIPLY); break;
+    case TOKEN_SLASH:         emitOp(parser, BC_DIVIDE); break;
+    case TOKEN_PERCENT:       emitOp(parser, BC_MODULO); break;
+    case TOKEN_DOT_DOT:       emitOp(parser, BC_CONCAT); break;
+    case TOKEN_STAR_STAR:     emitOp(parser, BC_POW); break;
+    case TOKEN_EQUAL_EQUAL:   emitOp(parser, BC_EQUAL); break;
+    case TOKEN_BANG_EQUAL:    emitOp(parser, BC_NOT_EQUAL); break;
+    case TOKEN_GREATER:       emitOp(parser, BC_GREATER); break;
+    case TOKEN_LESS:          emitOp(parser, BC_LESSER); break;
+    case TOKEN_GREATER_EQUAL: emitOp(parser, BC_GREATER_EQUAL); break;
+    case TOKEN_LESS_EQUAL:    emitOp(parser, BC_LESSER_EQUAL); break;
     default: return;
   }
 }
@@ -569,6 +793,37 @@ static u8 argumentList(struct Parser* parser) {
 static void call(struct Parser* parser, UNUSED bool canAssign) {
   u8 argCount = argumentList(parser);
   emitBytes(parser, BC_CALL, argCount);
+  adjustSlots(parser, -argCount);
+}
+
+static void yield(struct Parser* parser, UNUSED bool canAssign) {
+  if (parser->compiler->type == FUNCTION_TYPE_SCRIPT) {
+    error(parser, "Can only yield in functions.");
+  }
+
+  switch (parser->current.type) {
+    case TOKEN_SEMICOLON:
+    case TOKEN_RPAREN:
+    case TOKEN_RBRACKET:
+    case TOKEN_RBRACE:
+    case TOKEN_COMMA:
+      emitOp(parser, BC_NIL);
+      break;
+    default:
+      expression(parser);
+      break;
+  }
+  emitOp(parser, BC_YIELD);
+}
+
+static void resume(struct Parser* parser, UNUSED bool canAssign) {
+  consume(parser, TOKEN_LPAREN, "Expected '(' after 'resume'.");
+  u8 argCount = argumentList(parser);
+  if (argCount < 1 || argCount > 2) {
+    error(parser, "Expected a fiber and an optional value to resume with.");
+  }
+  emitBytes(parser, BC_RESUME, argCount);
+  adjustSlots(parser, 1 - argCount);
 }
 
 static void ternery(struct Parser* parser, UNUSED bool canAssign) {
@@ -577,13 +832,15 @@ static void ternery(struct Parser* parser, UNUSED bool canAssign) {
   consume(parser, TOKEN_RPAREN, "Expected ')'.");
 
   s32 thenJump = emitJump(parser, BC_JUMP_IF_FALSE);
-  emitByte(parser, BC_POP);
+  s32 slots = parser->compiler->slotCount;
+  emitOp(parser, BC_POP);
 
   expression(parser);
 
   s32 elseJump = emitJump(parser, BC_JUMP);
   patchJump(parser, thenJump);
-  emitByte(parser, BC_POP);
+  parser->compiler->slotCount = slots;
+  emitOp(parser, BC_POP);
 
   consume(parser, TOKEN_ELSE, "Expected 'else' in ternery operator.");
 
@@ -594,23 +851,24 @@ static void ternery(struct Parser* parser, UNUSED bool canAssign) {
 
 static void dot(struct Parser* parser, bool canAssign) {
   consume(parser, TOKEN_IDENTIFIER, "Expected property name.");
-  u8 name = identifierConstant(parser, &parser->previous);
+  s32 name = identifierConstant(parser, &parser->previous);
 
 #define COMPOUND_ASSIGNMENT(operator) \
     do { \
-      emitBytes(parser, BC_PUSH_PROPERTY, name); \
+      emitIndexed(parser, BC_PUSH_PROPERTY, name); \
       expression(parser); \
-      emitByte(parser, operator); \
-      emitBytes(parser, BC_SET_PROPERTY, name); \
+      emitOp(parser, operator); \
+      emitIndexed(parser, BC_SET_PROPERTY, name); \
     } while (false)
 
   if (canAssign && match(parser, TOKEN_EQUAL)) {
     expression(parser);
-    emitBytes(parser, BC_SET_PROPERTY, name);
+    emitIndexed(parser, BC_SET_PROPERTY, name);
   } else if (match(parser, TOKEN_LPAREN)) {
     u8 argCount = argumentList(parser);
-    emitBytes(parser, BC_INVOKE, name);
+    emitIndexed(parser, BC_INVOKE, name);
     emitByte(parser, argCount);
+    adjustSlots(parser, -argCount);
   } else if (canAssign && match(parser, TOKEN_PLUS_EQUAL)) {
     COMPOUND_ASSIGNMENT(BC_ADD);
   } else if (canAssign && match(parser, TOKEN_MINUS_EQUAL)) {
@@ -626,7 +884,7 @@ static void dot(struct Parser* parser, bool canAssign) {
   } else if (canAssign && match(parser, TOKEN_DOT_DOT_EQUAL)) {
     COMPOUND_ASSIGNMENT(BC_CONCAT);
   } else {
-    emitBytes(parser, BC_GET_PROPERTY, name);
+    emitIndexed(parser, BC_GET_PROPERTY, name);
   }
 #undef COMPOUND_ASSIGNMENT
 }
@@ -637,21 +895,21 @@ static void subscript(struct Parser* parser, bool canAssign) {
 
   if (canAssign && match(parser, TOKEN_EQUAL)) {
     expression(parser);
-    emitByte(parser, BC_SET_SUBSCRIPT);
+    emitOp(parser, BC_SET_SUBSCRIPT);
   } else {
-    emitByte(parser, BC_GET_SUBSCRIPT);
+    emitOp(parser, BC_GET_SUBSCRIPT);
   }
 }
 
 static void staticDot(struct Parser* parser, UNUSED bool canAssign) {
   consume(parser, TOKEN_IDENTIFIER, "Expected static method name.");
-  u8 name = identifierConstant(parser, &parser->previous);
-  emitBytes(parser, BC_GET_STATIC, name);
+  emitIndexed(parser, BC_GET_STATIC, identifierConstant(parser, &parser->previous));
 }
 
-static void function(struct Parser* parser, enum FunctionType type, bool isLambda) {
-  struct Compiler compiler;
-  initCompiler(parser, &compiler, type);
+static struct GcBcFunction* functionBody(struct Parser* parser, struct Compiler* compiler,
+    enum FunctionType type, bool isLambda, bool longJumps) {
+  initCompiler(parser, compiler, type);
+  compiler->longJumps = longJumps;
   beginScope(parser);
 
   if (match(parser, TOKEN_LPAREN)) {
@@ -663,8 +921,9 @@ static void function(struct Parser* parser, enum FunctionType type, bool isLambd
           break;
         }
         parser->compiler->function->arity++;
-        u8 constant = parseVariable(parser, false, "Expected variable name.");
+        s32 constant = parseVariable(parser, false, "Expected variable name.");
         defineVariable(parser, constant, false);
+        adjustSlots(parser, 1); // Pushed by the caller.
       } while (match(parser, TOKEN_COMMA));
     }
     consume(parser, TOKEN_RPAREN, "Expected ')'.");
@@ -674,7 +933,7 @@ static void function(struct Parser* parser, enum FunctionType type, bool isLambd
     block(parser);
   } else if (match(parser, TOKEN_RIGHT_ARROW)) {
     expression(parser);
-    emitByte(parser, BC_RETURN);
+    emitOp(parser, BC_RETURN);
     if (!isLambda) {
       consume(parser, TOKEN_SEMICOLON, "Expected ';' after expression.");
     }
@@ -687,12 +946,35 @@ static void function(struct Parser* parser, enum FunctionType type, bool isLambd
     error(parser, "Expected '{' or '=>'.");
   }
 
-  struct GcBcFunction* function = endCompiler(parser);
-  emitBytes(parser, BC_CLOSURE, makeConstant(parser, NEW_OBJ(function)));
+  return endCompiler(parser);
+}
+
+static void function(struct Parser* parser, enum FunctionType type, bool isLambda) {
+  // Where the body starts, in case it has to be compiled again.
+  struct Tokenizer tokenizer = *parser->tokenizer;
+  struct Token current = parser->current;
+  struct Token previous = parser->previous;
+
+  struct Compiler compiler;
+  struct GcBcFunction* function = functionBody(parser, &compiler, type, isLambda, false);
+  if (compiler.jumpTooLong && !parser->hadError) {
+    *parser->tokenizer = tokenizer;
+    parser->current = current;
+    parser->previous = previous;
+    function = functionBody(parser, &compiler, type, isLambda, true);
+  }
+
+  emitIndexed(parser, BC_CLOSURE, makeConstant(parser, NEW_OBJ(function)));
 
   for (s32 i = 0; i < function->upvalueCount; i++) {
-    emitByte(parser, compiler.upvalues[i].isLocal ? 1 : 0);
-    emitByte(parser, compiler.upvalues[i].index);
+    u16 index = compiler.upvalues[i].index;
+    u8 flags = compiler.upvalues[i].isLocal ? UPVALUE_LOCAL : 0;
+    if (index > UINT8_MAX) {
+      emitBytes(parser, flags | UPVALUE_WIDE, (index >> 8) & 0xff);
+      emitByte(parser, index & 0xff);
+    } else {
+      emitBytes(parser, flags, (u8)index);
+    }
   }
 }
 
@@ -702,36 +984,174 @@ static void lambda(struct Parser* parser, UNUSED bool canAssign) {
 
 static void literal(struct Parser* parser, UNUSED bool canAssign) {
   switch (parser->previous.type) {
-    case TOKEN_FALSE: emitByte(parser, BC_FALSE); break;
-    case TOKEN_TRUE: emitByte(parser, BC_TRUE); break;
-    case TOKEN_NIL: emitByte(parser, BC_NIL); break;
+    case TOKEN_FALSE: emitOp(parser, BC_FALSE); break;
+    case TOKEN_TRUE: emitOp(parser, BC_TRUE); break;
+    case TOKEN_NIL: emitOp(parser, BC_NIL); break;
     default: return;
   }
 }
 
+// Elements of a non-constant array literal are all pushed before the array
+// is built, so they have to fit comfortably on the stack, even several
+// calls deep.
+#define MAX_ARRAY_LITERAL (STACK_MAX / 8)
+
+// Checks whether the code emitted since `start` is a single literal load,
+// and if so stores the value it produces.
+static bool emittedLiteral(struct GcBcFunction* function, s32 start, Value* out) {
+  u8* bc = function->bc + start;
+  s32 length = function->bcCount - start;
+
+  // An element that failed to parse emitted nothing.
+  if (length <= 0) {
+    return false;
+  }
+  if (length == 1) {
+    switch (bc[0]) {
+      case BC_NIL: *out = NEW_NIL; return true;
+      case BC_TRUE: *out = NEW_BOOL(true); return true;
+      case BC_FALSE: *out = NEW_BOOL(false); return true;
+      default: return false;
+    }
+  }
+
+  s32 size;
+  s32 constant;
+  if (bc[0] == BC_CONSTANT) {
+    size = 2;
+    constant = bc[1];
+  } else if (bc[0] == BC_CONSTANT_LONG) {
+    size = 3;
+    constant = (bc[1] << 8) | bc[2];
+  } else {
+    return false;
+  }
+
+  Value value = function->constants.values[constant];
+  if (length == size) {
+    *out = value;
+    return true;
+  }
+  if (length == size + 1 && bc[size] == BC_NEGATE && IS_NUMBER(value)) {
+    *out = NEW_NUMBER(-AS_NUMBER(value));
+    return true;
+  }
+  return false;
+}
+
+// Emits code pushing the literal elements collected so far, followed by the
+// element compiled at `start`. Used when a constant array literal turns out
+// to contain a computed element.
+static void spillLiterals(
+    struct Parser* parser, struct GcArray* literals, s32 start) {
+  struct hs_State* H = parser->H;
+  struct GcBcFunction* function = currentFunction(parser);
+
+  s32 length = function->bcCount - start;
+  u8* bc = ALLOCATE(H, u8, length);
+  s32* lines = ALLOCATE(H, s32, length);
+  memcpy(bc, function->bc + start, length);
+  for (s32 i = 0; i < length; i++) {
+    lines[i] = lineAt(function, start + i);
+  }
+  truncateBytecode(function, start);
+
+  for (s32 i = 0; i < literals->values.count; i++) {
+    Value value = literals->values.values[i];
+    if (IS_NIL(value)) {
+      emitOp(parser, BC_NIL);
+    } else if (IS_BOOL(value)) {
+      emitOp(parser, AS_BOOL(value) ? BC_TRUE : BC_FALSE);
+    } else {
+      emitConstant(parser, value);
+    }
+  }
+
+  for (s32 i = 0; i < length; i++) {
+    writeBytecode(H, function, bc[i], lines[i]);
+  }
+
+  FREE_ARRAY(H, u8, bc, length);
+  FREE_ARRAY(H, s32, lines, length);
+  literals->values.count = 0;
+}
+
 static void array(struct Parser* parser, UNUSED bool canAssign) {
-  u8 count = 0;
+  struct hs_State* H = parser->H;
+  struct GcBcFunction* function = currentFunction(parser);
+
+  // Literal elements are collected here instead of being emitted. If every
+  // element is a literal, the array goes into the constant pool and is
+  // instantiated with a single copy.
+  struct GcArray* literals = newArray(H);
+  push(H, NEW_OBJ(literals));
+  bool isConstant = true;
+  // Collected literals aren't on the stack until they're spilled.
+  s32 slots = parser->compiler->slotCount;
+
+  s32 count = 0;
   if (!check(parser, TOKEN_RBRACKET)) {
     do {
-      expression(parser);
-      if (count == UINT8_MAX) {
-        error(parser, "Can't have more than 255 elements in an array literal.");
+      s32 start = function->bcCount;
+      s32 constantCount = function->constants.count;
+      // If this element is computed, the literals collected so far are
+      // spilled below it, so its own peak is measured separately and then
+      // counted on top of them.
+      s32 maxSlots = function->maxSlots;
+      if (isConstant) {
+        function->maxSlots = slots;
       }
+      expression(parser);
       count++;
 
-      if (!match(parser, TOKEN_COMMA) && !check(parser, TOKEN_RBRACKET)) {
-        error(parser, "Expected ','.");
+      if (isConstant) {
+        s32 peak = function->maxSlots;
+        function->maxSlots = maxSlots;
+        Value value;
+        if (emittedLiteral(function, start, &value)) {
+          writeValueArray(H, &literals->values, value);
+          truncateBytecode(function, start);
+          function->constants.count = constantCount;
+        } else {
+          spillLiterals(parser, literals, start);
+          isConstant = false;
+          if (peak + count - 1 > function->maxSlots) {
+            function->maxSlots = peak + count - 1;
+          }
+        }
+        adjustSlots(parser, slots + (isConstant ? 0 : count) - parser->compiler->slotCount);
+      }
+
+      if (!match(parser, TOKEN_COMMA)) {
+        if (!check(parser, TOKEN_RBRACKET)) {
+          error(parser, "Expected ','.");
+        }
+        break;
       }
     } while (!check(parser, TOKEN_RBRACKET));
   }
   consume(parser, TOKEN_RBRACKET, "Unterminated array literal.");
 
-  emitBytes(parser, BC_ARRAY, count);
+  if (isConstant && count > 0) {
+    emitIndexed(parser, BC_ARRAY_CONSTANT, makeConstant(parser, NEW_OBJ(literals)));
+  } else if (count <= UINT8_MAX) {
+    emitBytes(parser, BC_ARRAY, (u8)count);
+    adjustSlots(parser, 1 - count);
+  } else {
+    if (count > MAX_ARRAY_LITERAL) {
+      error(parser, "Too many computed elements in an array literal.");
+    }
+    emitByte(parser, BC_ARRAY_LONG);
+    emitBytes(parser, (count >> 8) & 0xff, count & 0xff);
+    adjustSlots(parser, 1 - count);
+  }
+
+  pop(H); // Literals
 }
 
 static void and_(struct Parser* parser, UNUSED bool canAssign) {
   s32 endJump = emitJump(parser, BC_JUMP_IF_FALSE);
-  emitByte(parser, BC_POP);
+  emitOp(parser, BC_POP);
   parsePrecedence(parser, PREC_AND);
   patchJump(parser, endJump);
 }
@@ -741,13 +1161,13 @@ static void or_(struct Parser* parser, UNUSED bool canAssign) {
   s32 endJump = emitJump(parser, BC_JUMP);
 
   patchJump(parser, elseJump);
-  emitByte(parser, BC_POP);
+  emitOp(parser, BC_POP);
 
   parsePrecedence(parser, PREC_OR);
   patchJump(parser, endJump);
 }
 
-static struct ParseRule rules[] = {
+static const struct ParseRule rules[] = {
   [TOKEN_LPAREN]          = {grouping, call,       PREC_CALL},
   [TOKEN_RPAREN]          = {NULL,     NULL,       PREC_NONE},
   [TOKEN_LBRACE]          = {NULL,     NULL,       PREC_NONE},
@@ -778,6 +1198,7 @@ static struct ParseRule rules[] = {
   [TOKEN_VAR]             = {NULL,     NULL,       PREC_NONE},
   [TOKEN_WHILE]           = {NULL,     NULL,       PREC_NONE},
   [TOKEN_FOR]             = {NULL,     NULL,       PREC_NONE},
+  [TOKEN_IN]              = {NULL,     NULL,       PREC_NONE},
   [TOKEN_LOOP]            = {NULL,     NULL,       PREC_NONE},
   [TOKEN_IF]              = {ternery,  NULL,       PREC_ASSIGNMENT},
   [TOKEN_ELSE]            = {NULL,     NULL,       PREC_NONE},
@@ -796,6 +1217,8 @@ static struct ParseRule rules[] = {
   [TOKEN_RETURN]          = {NULL,     NULL,       PREC_NONE},
   [TOKEN_ENUM]            = {NULL,     NULL,       PREC_NONE},
   [TOKEN_GLOBAL]          = {NULL,     NULL,       PREC_NONE},
+  [TOKEN_YIELD]           = {yield,    NULL,       PREC_NONE},
+  [TOKEN_RESUME]          = {resume,   NULL,       PREC_NONE},
   [TOKEN_BREAK]           = {NULL,     NULL,       PREC_NONE},
   [TOKEN_CONTINUE]        = {NULL,     NULL,       PREC_NONE},
   [TOKEN_STATIC]          = {NULL,     NULL,       PREC_NONE},
@@ -832,7 +1255,7 @@ static void parsePrecedence(struct Parser* parser, enum Precedence precedence) {
   }
 }
 
-static struct ParseRule* getRule(enum TokenType type) {
+static const struct ParseRule* getRule(enum TokenType type) {
   return &rules[type];
 }
 
@@ -850,20 +1273,20 @@ static void block(struct Parser* parser) {
 
 static void method(struct Parser* parser, bool isStatic) {
   consume(parser, TOKEN_IDENTIFIER, "Expected method name.");
-  u8 constant = identifierConstant(parser, &parser->previous);
+  s32 constant = identifierConstant(parser, &parser->previous);
 
   enum FunctionType type = isStatic 
       ? FUNCTION_TYPE_FUNCTION
       : FUNCTION_TYPE_METHOD;
   function(parser, type, false);
-  emitBytes(parser, isStatic ? BC_STATIC_METHOD : BC_METHOD, constant);
+  emitIndexed(parser, isStatic ? BC_STATIC_METHOD : BC_METHOD, constant);
 }
 
 static void functionDeclaration(struct Parser* parser, bool isGlobal) {
   if (parser->compiler->scopeDepth > 0) {
     error(parser, "Can only define functions in top level code.");
   }
-  u8 global = parseVariable(parser, isGlobal, "Expected function name.");
+  s32 global = parseVariable(parser, isGlobal, "Expected function name.");
   markInitialized(parser, isGlobal);
   function(parser, FUNCTION_TYPE_FUNCTION, false);
   defineVariable(parser, global, isGlobal);
@@ -871,7 +1294,7 @@ static void functionDeclaration(struct Parser* parser, bool isGlobal) {
 
 static void arrayDestructAssignment(struct Parser* parser) {
   u8 setters[UINT8_MAX];
-  u8 variables[UINT8_MAX];
+  s32 variables[UINT8_MAX];
   u8 variableCount = 0;
   do {
     if (variableCount == UINT8_MAX) {
@@ -905,18 +1328,19 @@ static void arrayDestructAssignment(struct Parser* parser) {
   expression(parser);
 
   for (u8 i = 0; i < variableCount; i++) {
-    emitBytes(parser, BC_DESTRUCT_ARRAY, i);
-    emitBytes(parser, setters[i], variables[i]);
-    emitByte(parser, BC_POP);
+    emitOp(parser, BC_DESTRUCT_ARRAY);
+    emitByte(parser, i);
+    emitIndexed(parser, setters[i], variables[i]);
+    emitOp(parser, BC_POP);
   }
 
-  emitByte(parser, BC_POP);
+  emitOp(parser, BC_POP);
   consume(parser, TOKEN_SEMICOLON, "Expected ';' after variable declaration.");
 }
 
 static void varDeclaration(struct Parser* parser, bool isGlobal) {
   if (match(parser, TOKEN_LBRACKET)) {
-    u8 variables[UINT8_MAX];
+    s32 variables[UINT8_MAX];
     struct Token tokens[UINT8_MAX];
     u8 variableCount = 0;
     // parse [x, y]
@@ -927,13 +1351,13 @@ static void varDeclaration(struct Parser* parser, bool isGlobal) {
       }
 
       struct Token identifier = parser->current;
-      u8 nameConstant = parseVariable(parser, isGlobal, "Expected identifier.");
+      s32 nameConstant = parseVariable(parser, isGlobal, "Expected identifier.");
       variables[variableCount] = nameConstant;
       tokens[variableCount] = identifier;
       variableCount++;
 
       if (!isGlobal) {
-        emitByte(parser, BC_NIL); // Reserve
+        emitOp(parser, BC_NIL); // Reserve
       }
     } while (match(parser, TOKEN_COMMA));
 
@@ -943,25 +1367,26 @@ static void varDeclaration(struct Parser* parser, bool isGlobal) {
 
     // Assign the values of the array.
     for (u8 i = 0; i < variableCount; i++) {
-      emitBytes(parser, BC_DESTRUCT_ARRAY, i);
+      emitOp(parser, BC_DESTRUCT_ARRAY);
+      emitByte(parser, i);
       defineVariable(parser, variables[i], isGlobal);
 
       // Can't set locals like this.
       if (!isGlobal) {
-        u8 local = resolveLocal(parser, parser->compiler, &tokens[i]);
-        emitBytes(parser, BC_SET_LOCAL, local);
-        emitByte(parser, BC_POP);
+        s32 local = resolveLocal(parser, parser->compiler, &tokens[i]);
+        emitIndexed(parser, BC_SET_LOCAL, local);
+        emitOp(parser, BC_POP);
       }
     }
 
-    emitByte(parser, BC_POP);
+    emitOp(parser, BC_POP);
   } else {
-    u8 global = parseVariable(parser, isGlobal, "Expected identifier.");
+    s32 global = parseVariable(parser, isGlobal, "Expected identifier.");
 
     if (match(parser, TOKEN_EQUAL)) {
       expression(parser);
     } else {
-      emitByte(parser, BC_NIL);
+      emitOp(parser, BC_NIL);
     }
 
     defineVariable(parser, global, isGlobal);
@@ -985,10 +1410,10 @@ static void structDeclaration(struct Parser* parser, bool isGlobal) {
 
   consume(parser, TOKEN_IDENTIFIER, "Expected struct identifier.");
   struct Token structName = parser->previous;
-  u8 nameConstant = identifierConstant(parser, &parser->previous);
+  s32 nameConstant = identifierConstant(parser, &parser->previous);
   declareVariable(parser, isGlobal);
 
-  emitBytes(parser, BC_STRUCT, nameConstant);
+  emitIndexed(parser, BC_STRUCT, nameConstant);
   defineVariable(parser, nameConstant, isGlobal);
 
   namedVariable(parser, structName, false);
@@ -1005,10 +1430,10 @@ static void structDeclaration(struct Parser* parser, bool isGlobal) {
       if (match(parser, TOKEN_EQUAL)) {
         expression(parser);
       } else {
-        emitByte(parser, BC_NIL);
+        emitOp(parser, BC_NIL);
       }
 
-      emitBytes(parser, BC_STRUCT_FIELD, identifierConstant(parser, &name));
+      emitIndexed(parser, BC_STRUCT_FIELD, identifierConstant(parser, &name));
 
       consume(parser, TOKEN_SEMICOLON, "Expected ';' after field.");
     } else if (match(parser, TOKEN_FUNC)) {
@@ -1021,7 +1446,7 @@ static void structDeclaration(struct Parser* parser, bool isGlobal) {
 
   consume(parser, TOKEN_RBRACE, "Unterminated struct declaration.");
 
-  emitByte(parser, BC_POP); // Struct
+  emitOp(parser, BC_POP); // Struct
 
   parser->structCompiler = parser->structCompiler->enclosing;
 }
@@ -1033,10 +1458,10 @@ void enumDeclaration(struct Parser* parser, bool isGlobal) {
 
   consume(parser, TOKEN_IDENTIFIER, "Expected enum identifier.");
   struct Token enumName = parser->previous;
-  u8 nameConstant = identifierConstant(parser, &parser->previous);
+  s32 nameConstant = identifierConstant(parser, &parser->previous);
   declareVariable(parser, isGlobal);
 
-  emitBytes(parser, BC_ENUM, nameConstant);
+  emitIndexed(parser, BC_ENUM, nameConstant);
   defineVariable(parser, nameConstant, isGlobal);
 
   namedVariable(parser, enumName, false);
@@ -1051,8 +1476,8 @@ void enumDeclaration(struct Parser* parser, bool isGlobal) {
       }
 
       consume(parser, TOKEN_IDENTIFIER, "Expected enum value.");
-      emitByte(parser, BC_ENUM_VALUE);
-      emitByte(parser, identifierConstant(parser, &parser->previous));
+      emitIndexed(
+          parser, BC_ENUM_VALUE, identifierConstant(parser, &parser->previous));
       emitByte(parser, enumValue++);
 
       if (!match(parser, TOKEN_COMMA) && !check(parser, TOKEN_RBRACE)) {
@@ -1063,7 +1488,7 @@ void enumDeclaration(struct Parser* parser, bool isGlobal) {
 
   consume(parser, TOKEN_RBRACE, "Unterminated enum declaration.");
 
-  emitByte(parser, BC_POP); // Enum
+  emitOp(parser, BC_POP); // Enum
 }
 
 static void globalDeclaration(struct Parser* parser) {
@@ -1082,7 +1507,7 @@ static void globalDeclaration(struct Parser* parser) {
 
 static void expressionStatement(struct Parser* parser) {
   expression(parser);
-  emitByte(parser, BC_POP);
+  emitOp(parser, BC_POP);
   consume(parser, TOKEN_SEMICOLON, "Expected ';' after expression.");
 }
 
@@ -1092,13 +1517,15 @@ static void ifStatement(struct Parser* parser) {
   consume(parser, TOKEN_RPAREN, "Expected ')'.");
   
   s32 thenJump = emitJump(parser, BC_JUMP_IF_FALSE);
-  emitByte(parser, BC_POP);
+  s32 slots = parser->compiler->slotCount;
+  emitOp(parser, BC_POP);
 
   statement(parser);
 
   s32 elseJump = emitJump(parser, BC_JUMP);
   patchJump(parser, thenJump);
-  emitByte(parser, BC_POP);
+  parser->compiler->slotCount = slots; // The condition is still there.
+  emitOp(parser, BC_POP);
 
   if (match(parser, TOKEN_ELSE)) {
     statement(parser);
@@ -1149,7 +1576,7 @@ void matchStatement(struct Parser* parser) {
     patchJump(parser, caseEnds[i]);
   }
 
-  emitByte(parser, BC_POP); // Expression
+  emitOp(parser, BC_POP); // Expression
 
   consume(parser, TOKEN_RBRACE, "Expected '}'");
 }
@@ -1218,7 +1645,8 @@ static void whileStatement(struct Parser* parser) {
   }
 
   s32 exitJump = emitJump(parser, BC_JUMP_IF_FALSE);
-  emitByte(parser, BC_POP);
+  s32 slots = parser->compiler->slotCount;
+  emitOp(parser, BC_POP);
 
   loop.bodyStart = currentFunction(parser)->bcCount;
   statement(parser);
@@ -1226,9 +1654,79 @@ static void whileStatement(struct Parser* parser) {
   emitLoop(parser, loop.start);
 
   patchJump(parser, exitJump);
-  emitByte(parser, BC_POP);
+  parser->compiler->slotCount = slots;
+  emitOp(parser, BC_POP);
+
+  endLoop(parser, &loop);
+}
+
+// for (value in iterable) or for (key, value in iterable)
+//
+// Four locals hold the loop state: the iterable, a cursor, the key and the
+// value. BC_FOR_PREP checks the iterable once, then BC_FOR_ITER advances the
+// cursor and fills in the key and value each step.
+static void forStatement(struct Parser* parser) {
+  beginScope(parser);
+
+  consume(parser, TOKEN_LPAREN, "Expected '(' after 'for'.");
+  consume(parser, TOKEN_IDENTIFIER, "Expected loop variable.");
+  struct Token keyName = parser->previous;
+  struct Token valueName = keyName;
+  bool hasKey = match(parser, TOKEN_COMMA);
+  if (hasKey) {
+    consume(parser, TOKEN_IDENTIFIER, "Expected loop variable.");
+    valueName = parser->previous;
+  }
+  consume(parser, TOKEN_IN, "Expected 'in' after loop variables.");
+
+  expression(parser);
+  consume(parser, TOKEN_RPAREN, "Expected ')' after for clause.");
+
+  s32 iterSlot = parser->compiler->localCount;
+  addHiddenLocal(parser, "@iter");
+  emitOp(parser, BC_NIL);
+  addHiddenLocal(parser, "@cursor");
+  emitOp(parser, BC_NIL);
+  if (hasKey) {
+    addLocal(parser, keyName);
+  } else {
+    addHiddenLocal(parser, "@key");
+  }
+  emitOp(parser, BC_NIL);
+  addLocal(parser, valueName);
+
+  emitIndexed(parser, BC_FOR_PREP, iterSlot);
+
+  struct Loop loop;
+  beginLoop(parser, &loop);
+
+  if (match(parser, TOKEN_COLON)) {
+    consume(parser, TOKEN_IDENTIFIER, "Expected loop label.");
+    loop.isNamed = true;
+    loop.name = parser->previous;
+  }
+
+  // The long variant has both a wide slot and a long jump.
+  bool longIter = iterSlot > UINT8_MAX || parser->compiler->longJumps;
+  if (longIter) {
+    emitByte(parser, BC_FOR_ITER_LONG);
+    emitBytes(parser, (iterSlot >> 8) & 0xff, iterSlot & 0xff);
+    emitByte(parser, 0xff);
+  } else {
+    emitBytes(parser, BC_FOR_ITER, (u8)iterSlot);
+  }
+  emitByte(parser, 0xff);
+  emitByte(parser, 0xff);
+  s32 exitJump = currentFunction(parser)->bcCount - (longIter ? 3 : 2);
+
+  loop.bodyStart = currentFunction(parser)->bcCount;
+  statement(parser);
+
+  emitLoop(parser, loop.start);
+  patchJumpOperand(parser, exitJump, longIter);
 
   endLoop(parser, &loop);
+  endScope(parser);
 }
 
 static void loopStatement(struct Parser* parser) {
@@ -1260,7 +1758,7 @@ static void returnStatement(struct Parser* parser) {
 
   expression(parser);
   consume(parser, TOKEN_SEMICOLON, "Expected ';' after return value.");
-  emitByte(parser, BC_RETURN);
+  emitOp(parser, BC_RETURN);
 }
 
 static void synchronize(struct Parser* parser) {
@@ -1320,6 +1818,8 @@ static void statement(struct Parser* parser) {
     matchStatement(parser);
   } else if (match(parser, TOKEN_WHILE)) {
     whileStatement(parser);
+  } else if (match(parser, TOKEN_FOR)) {
+    forStatement(parser);
   } else if (match(parser, TOKEN_LOOP)) {
     loopStatement(parser);
   } else if (match(parser, TOKEN_LBRACE)) {
@@ -1339,13 +1839,20 @@ static void statement(struct Parser* parser) {
   }
 }
 
-struct GcBcFunction* compile(struct hs_State* H, struct Parser* parser, const char* source) {
+void initParser(struct hs_State* H, struct Parser* parser) {
   parser->H = H;
+  parser->current.value = NEW_NIL;
+  parser->previous.value = NEW_NIL;
   parser->compiler = NULL;
   parser->structCompiler = NULL;
   parser->tokenizer = NULL;
   parser->hadError = false;
   parser->panicMode = false;
+}
+
+static struct GcBcFunction* compileScript(struct hs_State* H, struct Parser* parser,
+    const char* source, bool longJumps, bool* jumpTooLong) {
+  initParser(H, parser);
 
   struct Tokenizer tokenizer;
   initTokenizer(H, &tokenizer, source);
@@ -1354,13 +1861,29 @@ struct GcBcFunction* compile(struct hs_State* H, struct Parser* parser, const ch
   struct Compiler compiler;
   initCompiler(parser, &compiler, FUNCTION_TYPE_SCRIPT);
   compiler.localOffset = 1;
+  compiler.longJumps = longJumps;
 
   advance(parser);
   while (!match(parser, TOKEN_EOF)) {
     declaration(parser);
   }
 
-  struct GcBcFunction* function = endCompiler(parser);
+  *jumpTooLong = compiler.jumpTooLong;
+  return endCompiler(parser);
+}
+
+struct GcBcFunction* compile(struct hs_State* H, struct Parser* parser, const char* source) {
+  u64 start = H->tracer != NULL ? traceNow() : 0;
+
+  bool jumpTooLong;
+  struct GcBcFunction* function = compileScript(H, parser, source, false, &jumpTooLong);
+  if (jumpTooLong && !parser->hadError) {
+    function = compileScript(H, parser, source, true, &jumpTooLong);
+  }
+
+  if (H->tracer != NULL && start != 0) {
+    traceSpan(H->tracer, "compiler", "compile", start, traceNow());
+  }
   return parser->hadError ? NULL : function;
 }
 
@@ -4,6 +4,11 @@
 #include "tokenizer.h"
 #include "object.h"
 
+// A function's locals all live in its frame on the stack, so they stop well
+// short of a fiber's whole stack, let alone what BC_GET_LOCAL_LONG could
+// address.
+#define LOCALS_MAX (U8_COUNT * 4)
+
 struct Loop {
   s32 start;
   s32 bodyStart;
@@ -22,7 +27,7 @@ struct Local {
 };
 
 struct CompilerUpvalue {
-  u8 index;
+  u16 index;
   bool isLocal;
 };
 
@@ -39,11 +44,20 @@ struct Compiler {
   enum FunctionType type;
 
   s32 localOffset;
-  struct Local locals[U8_COUNT];
+  struct Local* locals;
+  s32 localCapacity;
   struct Loop* loop;
   s32 localCount;
   struct CompilerUpvalue upvalues[U8_COUNT];
   s32 scopeDepth;
+  // Values on the stack at this point of the function, locals included.
+  s32 slotCount;
+
+  // Forward jumps are emitted before their targets are known, so they all
+  // get two-byte offsets unless longJumps is set. Overflowing one sets
+  // jumpTooLong, and the function is compiled again with longJumps.
+  bool longJumps;
+  bool jumpTooLong;
 };
 
 struct StructField {
@@ -65,6 +79,7 @@ struct Parser {
   bool panicMode;
 };
 
+void initParser(struct hs_State* H, struct Parser* parser);
 struct GcBcFunction* compile(struct hs_State* H, struct Parser* parser, const char* source);
 void markCompilerRoots(struct hs_State* H, struct Parser* parser);
 
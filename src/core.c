@@ -1,24 +1,29 @@
+#define _POSIX_C_SOURCE 199309L
+
 #include "common.h"
 #include "modules.h"
 #include "memory.h"
+#include "table.h"
+#include "tostring.h"
 
+#include <math.h>
 #include <stdio.h>
+#include <string.h>
 #include <time.h>
 
-static void core_print(struct hs_State* H, UNUSED s32 argCount) {
+static Value core_print(struct hs_State* H, Value* args, s32 argCount) {
   for (s32 i = 1; i <= argCount; i++) {
-    size_t length;
-    const char* str = hs_toString(H, i, &length);
-    fwrite(str, sizeof(char), length, stdout);
+    struct GcString* str = toString(H, args[i]);
+    fwrite(str->chars, sizeof(char), str->length, H->out);
     if (i != argCount) {
-      putc('\t', stdout);
+      putc('\t', H->out);
     }
   }
-  putc('\n', stdout);
-  hs_pushNil(H);
+  putc('\n', H->out);
+  return NEW_NIL;
 }
 
-static void core_input(struct hs_State* H, UNUSED s32 argCount) {
+static Value core_input(struct hs_State* H, UNUSED Value* args, UNUSED s32 argCount) {
   s32 capacity = 8;
   s32 count = 0;
   char* input = ALLOCATE(H, char, capacity);
@@ -33,28 +38,88 @@ static void core_input(struct hs_State* H, UNUSED s32 argCount) {
     input[count++] = (char)c;
   }
 
-  hs_pushString(H, input, count);
+  struct GcString* str = copyString(H, input, count);
   FREE_ARRAY(H, char, input, capacity);
+  return NEW_OBJ(str);
+}
+
+static Value core_toString(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  return NEW_OBJ(toString(H, args[1]));
 }
 
-static void core_toString(struct hs_State* H, UNUSED s32 argCount) {
-  size_t length;
-  const char* str = hs_toString(H, 1, &length);
-  hs_pushString(H, str, length);
+// Wall time from a monotonic clock. clock() measures CPU time for the whole
+// process, which runs ahead of real time when several states run on
+// different threads.
+static Value core_clock(UNUSED struct hs_State* H, UNUSED Value* args, UNUSED s32 argCount) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return NEW_NUMBER((f64)now.tv_sec + (f64)now.tv_nsec / 1e9);
 }
 
-static void core_clock(struct hs_State* H, UNUSED s32 argCount) {
-  hs_pushNumber(H, (f64)clock() / CLOCKS_PER_SEC);
+static void setStat(
+    struct hs_State* H, struct GcInstance* stats, const char* name, f64 value) {
+  struct GcString* key = copyString(H, name, strlen(name));
+  push(H, NEW_OBJ(key));
+  tableSet(H, &stats->fields, key, NEW_NUMBER(value));
+  pop(H);
 }
 
-struct hs_FuncInfo core[] = {
+#define NS_PER_MS 1e6
+
+// The collector's numbers as a GcStats instance, with times in milliseconds.
+static Value core_gcStats(struct hs_State* H, UNUSED Value* args, UNUSED s32 argCount) {
+  // Building the instance can itself collect garbage.
+  struct hs_GcStats gc = H->gcStats;
+  size_t bytesAllocated = H->bytesAllocated;
+
+  struct GcString* name = copyString(H, "GcStats", 7);
+  push(H, NEW_OBJ(name));
+  struct GcStruct* strooct = newStruct(H, name);
+  push(H, NEW_OBJ(strooct));
+  struct GcInstance* stats = newInstance(H, strooct);
+  push(H, NEW_OBJ(stats));
+
+  setStat(H, stats, "collections", (f64)gc.collections);
+  setStat(H, stats, "totalPauseMs", (f64)gc.totalPauseNs / NS_PER_MS);
+  setStat(H, stats, "totalBytesFreed", (f64)gc.totalBytesFreed);
+  setStat(H, stats, "pauseMs", (f64)gc.pauseNs / NS_PER_MS);
+  setStat(H, stats, "markMs", (f64)gc.markNs / NS_PER_MS);
+  setStat(H, stats, "sweepMs", (f64)gc.sweepNs / NS_PER_MS);
+  setStat(H, stats, "bytesBefore", (f64)gc.bytesBefore);
+  setStat(H, stats, "bytesAfter", (f64)gc.bytesAfter);
+  setStat(H, stats, "objectsFreed", (f64)gc.objectsFreed);
+  setStat(H, stats, "nextGc", (f64)gc.nextGc);
+  setStat(H, stats, "bytesAllocated", (f64)bytesAllocated);
+
+  pop(H);
+  pop(H);
+  pop(H);
+  return NEW_OBJ(stats);
+}
+
+static const struct NativeInfo core[] = {
   {core_print, "print", -1},
   {core_toString, "toString", 1},
   {core_clock, "clock", 0},
   {core_input, "input", 0},
+  {core_gcStats, "gcStats", 0},
   {NULL, NULL, -1},
 };
 
+static const struct NumberNativeInfo math[] = {
+  {sqrt, NULL, "sqrt"},
+  {floor, NULL, "floor"},
+  {ceil, NULL, "ceil"},
+  {fabs, NULL, "abs"},
+  {sin, NULL, "sin"},
+  {cos, NULL, "cos"},
+  {NULL, atan2, "atan2"},
+  {NULL, fmin, "min"},
+  {NULL, fmax, "max"},
+  {NULL, NULL, NULL},
+};
+
 void openCore(struct hs_State* H) {
-  hs_registerGlobalFunctions(H, core);
+  registerNatives(H, &H->globals, core);
+  registerNumberNatives(H, &H->globals, math);
 }
@@ -26,6 +26,13 @@ static s32 byteInstruction(const char* name, struct GcBcFunction* function, s32
   return offset + 2; 
 }
 
+static s32 shortInstruction(const char* name, struct GcBcFunction* function, s32 offset) {
+  u16 operand = (u16)(function->bc[offset + 1] << 8);
+  operand |= function->bc[offset + 2];
+  printf("%-16s %4d\n", name, operand);
+  return offset + 3;
+}
+
 static int jumpInstruction(
     const char* name, s32 sign, struct GcBcFunction* function, s32 offset) {
   u16 jump = (u16)(function->bc[offset + 1] << 8);
@@ -34,6 +41,33 @@ static int jumpInstruction(
   return offset + 3;
 }
 
+static s32 longJumpInstruction(
+    const char* name, s32 sign, struct GcBcFunction* function, s32 offset) {
+  s32 jump = (function->bc[offset + 1] << 16) | (function->bc[offset + 2] << 8);
+  jump |= function->bc[offset + 3];
+  printf("%-16s %4d -> %4d\n", name, offset, offset + 4 + sign * jump);
+  return offset + 4;
+}
+
+static s32 forIterInstruction(
+    const char* name, struct GcBcFunction* function, s32 offset) {
+  u8 slot = function->bc[offset + 1];
+  u16 jump = (u16)(function->bc[offset + 2] << 8);
+  jump |= function->bc[offset + 3];
+  printf("%-16s %4d %4d -> %4d\n", name, slot, offset, offset + 4 + jump);
+  return offset + 4;
+}
+
+static s32 longForIterInstruction(
+    const char* name, struct GcBcFunction* function, s32 offset) {
+  u16 slot = (u16)(function->bc[offset + 1] << 8);
+  slot |= function->bc[offset + 2];
+  s32 jump = (function->bc[offset + 3] << 16) | (function->bc[offset + 4] << 8);
+  jump |= function->bc[offset + 5];
+  printf("%-16s %4d %4d -> %4d\n", name, slot, offset, offset + 6 + jump);
+  return offset + 6;
+}
+
 static s32 constantInstruction(
     struct hs_State* H, const char* name, struct GcBcFunction* function, s32 offset) {
   u8 constant = function->bc[offset + 1];
@@ -43,6 +77,16 @@ static s32 constantInstruction(
   return offset + 2;
 }
 
+static s32 longConstantInstruction(
+    struct hs_State* H, const char* name, struct GcBcFunction* function, s32 offset) {
+  u16 constant = (u16)(function->bc[offset + 1] << 8);
+  constant |= function->bc[offset + 2];
+  printf("%-16s %4d '", name, constant);
+  printValue(H, function->constants.values[constant]);
+  printf("'\n");
+  return offset + 3;
+}
+
 static s32 invokeInstruction(
     struct hs_State* H, const char* name, struct GcBcFunction* function, s32 offset) {
   u8 constant = function->bc[offset + 1];
@@ -53,18 +97,128 @@ static s32 invokeInstruction(
   return offset + 3;
 }
 
+static s32 longInvokeInstruction(
+    struct hs_State* H, const char* name, struct GcBcFunction* function, s32 offset) {
+  u16 constant = (u16)(function->bc[offset + 1] << 8);
+  constant |= function->bc[offset + 2];
+  u8 argCount = function->bc[offset + 3];
+  printf("%-16s (%d args) %4d '", name, argCount, constant);
+  printValue(H, function->constants.values[constant]);
+  printf("'\n");
+  return offset + 4;
+}
+
+static const char* opcodeNames[] = {
+  [BC_CONSTANT] = "OP_CONSTANT",
+  [BC_CONSTANT_LONG] = "OP_CONSTANT_LONG",
+  [BC_NIL] = "OP_NIL",
+  [BC_TRUE] = "OP_TRUE",
+  [BC_FALSE] = "OP_FALSE",
+  [BC_POP] = "OP_POP",
+  [BC_ARRAY] = "OP_ARRAY",
+  [BC_ARRAY_LONG] = "OP_ARRAY_LONG",
+  [BC_ARRAY_CONSTANT] = "OP_ARRAY_CONSTANT",
+  [BC_ARRAY_CONSTANT_LONG] = "OP_ARRAY_CONSTANT_LONG",
+  [BC_GET_SUBSCRIPT] = "OP_GET_SUBSCRIPT",
+  [BC_SET_SUBSCRIPT] = "OP_SET_SUBSCRIPT",
+  [BC_DEFINE_GLOBAL] = "OP_DEFINE_GLOBAL",
+  [BC_DEFINE_GLOBAL_LONG] = "OP_DEFINE_GLOBAL_LONG",
+  [BC_GET_GLOBAL] = "OP_GET_GLOBAL",
+  [BC_GET_GLOBAL_LONG] = "OP_GET_GLOBAL_LONG",
+  [BC_SET_GLOBAL] = "OP_SET_GLOBAL",
+  [BC_SET_GLOBAL_LONG] = "OP_SET_GLOBAL_LONG",
+  [BC_GET_UPVALUE] = "OP_GET_UPVALUE",
+  [BC_SET_UPVALUE] = "OP_SET_UPVALUE",
+  [BC_GET_LOCAL] = "OP_GET_LOCAL",
+  [BC_GET_LOCAL_LONG] = "OP_GET_LOCAL_LONG",
+  [BC_SET_LOCAL] = "OP_SET_LOCAL",
+  [BC_SET_LOCAL_LONG] = "OP_SET_LOCAL_LONG",
+  [BC_INIT_PROPERTY] = "OP_INIT_PROPERTY",
+  [BC_INIT_PROPERTY_LONG] = "OP_INIT_PROPERTY_LONG",
+  [BC_GET_STATIC] = "OP_GET_STATIC_METHOD",
+  [BC_GET_STATIC_LONG] = "OP_GET_STATIC_METHOD_LONG",
+  [BC_PUSH_PROPERTY] = "OP_PUSH_PROPERTY",
+  [BC_PUSH_PROPERTY_LONG] = "OP_PUSH_PROPERTY_LONG",
+  [BC_GET_PROPERTY] = "OP_GET_PROPERTY",
+  [BC_GET_PROPERTY_LONG] = "OP_GET_PROPERTY_LONG",
+  [BC_SET_PROPERTY] = "OP_SET_PROPERTY",
+  [BC_SET_PROPERTY_LONG] = "OP_SET_PROPERTY_LONG",
+  [BC_DESTRUCT_ARRAY] = "OP_DESTRUCT_ARRAY",
+  [BC_EQUAL] = "OP_EQUAL",
+  [BC_NOT_EQUAL] = "OP_NOT_EQUAL",
+  [BC_GREATER] = "OP_GREATER",
+  [BC_GREATER_EQUAL] = "OP_GREATER_EQUAL",
+  [BC_LESSER] = "OP_LESSER",
+  [BC_LESSER_EQUAL] = "OP_LESSER_EQUAL",
+  [BC_CONCAT] = "OP_CONCAT",
+  [BC_ADD] = "OP_ADD",
+  [BC_SUBTRACT] = "OP_SUBTRACT",
+  [BC_MULTIPLY] = "OP_MULTIPLY",
+  [BC_DIVIDE] = "OP_DIVIDE",
+  [BC_MODULO] = "OP_MODULO",
+  [BC_POW] = "OP_POW",
+  [BC_NEGATE] = "OP_NEGATE",
+  [BC_NOT] = "OP_NOT",
+  [BC_JUMP] = "OP_JUMP",
+  [BC_JUMP_LONG] = "OP_JUMP_LONG",
+  [BC_JUMP_IF_FALSE] = "OP_JUMP_IF_FALSE",
+  [BC_JUMP_IF_FALSE_LONG] = "OP_JUMP_IF_FALSE_LONG",
+  [BC_INEQUALITY_JUMP] = "OP_INEQUALITY_JUMP",
+  [BC_INEQUALITY_JUMP_LONG] = "OP_INEQUALITY_JUMP_LONG",
+  [BC_LOOP] = "OP_LOOP",
+  [BC_LOOP_LONG] = "OP_LOOP_LONG",
+  [BC_FOR_PREP] = "OP_FOR_PREP",
+  [BC_FOR_PREP_LONG] = "OP_FOR_PREP_LONG",
+  [BC_FOR_ITER] = "OP_FOR_ITER",
+  [BC_FOR_ITER_LONG] = "OP_FOR_ITER_LONG",
+  [BC_CALL] = "OP_CALL",
+  [BC_INSTANCE] = "OP_INSTANCE",
+  [BC_CLOSURE] = "OP_CLOSURE",
+  [BC_CLOSURE_LONG] = "OP_CLOSURE_LONG",
+  [BC_CLOSE_UPVALUE] = "OP_CLOSE_UPVALUE",
+  [BC_RETURN] = "OP_RETURN",
+  [BC_ENUM] = "OP_ENUM",
+  [BC_ENUM_LONG] = "OP_ENUM_LONG",
+  [BC_ENUM_VALUE] = "OP_ENUM_VALUE",
+  [BC_ENUM_VALUE_LONG] = "OP_ENUM_VALUE_LONG",
+  [BC_STRUCT] = "OP_STRUCT",
+  [BC_STRUCT_LONG] = "OP_STRUCT_LONG",
+  [BC_STRUCT_FIELD] = "OP_SET_STRUCT_FIELD",
+  [BC_STRUCT_FIELD_LONG] = "OP_SET_STRUCT_FIELD_LONG",
+  [BC_METHOD] = "OP_METHOD",
+  [BC_METHOD_LONG] = "OP_METHOD_LONG",
+  [BC_STATIC_METHOD] = "OP_STATIC_METHOD",
+  [BC_STATIC_METHOD_LONG] = "OP_STATIC_METHOD_LONG",
+  [BC_INVOKE] = "OP_INVOKE",
+  [BC_INVOKE_LONG] = "OP_INVOKE_LONG",
+  [BC_YIELD] = "OP_YIELD",
+  [BC_RESUME] = "OP_RESUME",
+  [BC_BREAK] = "OP_BREAK",
+};
+
+const char* opcodeName(u8 instruction) {
+  if (instruction >= sizeof(opcodeNames) / sizeof(opcodeNames[0])
+      || opcodeNames[instruction] == NULL) {
+    return "OP_UNKNOWN";
+  }
+  return opcodeNames[instruction];
+}
+
 s32 disassembleInstruction(struct hs_State* H, struct GcBcFunction* function, s32 offset) {
   printf("%04d ", offset);
-  if (offset > 0 && function->lines[offset] == function->lines[offset - 1]) {
+  s32 line = lineAt(function, offset);
+  if (offset > 0 && line == lineAt(function, offset - 1)) {
     printf("   | ");
   } else {
-    printf("%4d ", function->lines[offset]);
+    printf("%4d ", line);
   }
 
   u8 instruction = function->bc[offset];
   switch (instruction) {
     case BC_CONSTANT:
       return constantInstruction(H, "OP_CONSTANT", function, offset);
+    case BC_CONSTANT_LONG:
+      return longConstantInstruction(H, "OP_CONSTANT_LONG", function, offset);
     case BC_NIL:
       return simpleInstruction("OP_NIL", offset);
     case BC_FALSE:
@@ -75,38 +229,66 @@ s32 disassembleInstruction(struct hs_State* H, struct GcBcFunction* function, s3
       return simpleInstruction("OP_POP", offset);
     case BC_ARRAY:
       return byteInstruction("OP_ARRAY", function, offset);
+    case BC_ARRAY_LONG:
+      return shortInstruction("OP_ARRAY_LONG", function, offset);
+    case BC_ARRAY_CONSTANT:
+      return constantInstruction(H, "OP_ARRAY_CONSTANT", function, offset);
+    case BC_ARRAY_CONSTANT_LONG:
+      return longConstantInstruction(H, "OP_ARRAY_CONSTANT_LONG", function, offset);
     case BC_GET_SUBSCRIPT:
       return simpleInstruction("OP_GET_SUBSCRIPT", offset);
     case BC_SET_SUBSCRIPT:
       return simpleInstruction("OP_SET_SUBSCRIPT", offset);
     case BC_DEFINE_GLOBAL:
       return constantInstruction(H, "OP_DEFINE_GLOBAL", function, offset);
+    case BC_DEFINE_GLOBAL_LONG:
+      return longConstantInstruction(H, "OP_DEFINE_GLOBAL_LONG", function, offset);
     case BC_GET_GLOBAL:
       return constantInstruction(H, "OP_GET_GLOBAL", function, offset);
+    case BC_GET_GLOBAL_LONG:
+      return longConstantInstruction(H, "OP_GET_GLOBAL_LONG", function, offset);
     case BC_SET_GLOBAL:
       return constantInstruction(H, "OP_SET_GLOBAL", function, offset);
+    case BC_SET_GLOBAL_LONG:
+      return longConstantInstruction(H, "OP_SET_GLOBAL_LONG", function, offset);
     case BC_GET_UPVALUE:
       return byteInstruction("OP_GET_UPVALUE", function, offset);
     case BC_SET_UPVALUE:
       return byteInstruction("OP_SET_UPVALUE", function, offset);
     case BC_GET_LOCAL:
       return byteInstruction("OP_GET_LOCAL", function, offset);
+    case BC_GET_LOCAL_LONG:
+      return shortInstruction("OP_GET_LOCAL_LONG", function, offset);
     case BC_SET_LOCAL:
       return byteInstruction("OP_SET_LOCAL", function, offset);
+    case BC_SET_LOCAL_LONG:
+      return shortInstruction("OP_SET_LOCAL_LONG", function, offset);
     case BC_INIT_PROPERTY:
-      return byteInstruction("OP_INIT_PROPERTY", function, offset);
+      return constantInstruction(H, "OP_INIT_PROPERTY", function, offset);
+    case BC_INIT_PROPERTY_LONG:
+      return longConstantInstruction(H, "OP_INIT_PROPERTY_LONG", function, offset);
     case BC_GET_STATIC:
       return constantInstruction(H, "OP_GET_STATIC_METHOD", function, offset);
+    case BC_GET_STATIC_LONG:
+      return longConstantInstruction(H, "OP_GET_STATIC_METHOD_LONG", function, offset);
     case BC_PUSH_PROPERTY:
       return constantInstruction(H, "OP_PUSH_PROPERTY", function, offset);
+    case BC_PUSH_PROPERTY_LONG:
+      return longConstantInstruction(H, "OP_PUSH_PROPERTY_LONG", function, offset);
     case BC_GET_PROPERTY:
       return constantInstruction(H, "OP_GET_PROPERTY", function, offset);
+    case BC_GET_PROPERTY_LONG:
+      return longConstantInstruction(H, "OP_GET_PROPERTY_LONG", function, offset);
     case BC_SET_PROPERTY:
       return constantInstruction(H, "OP_SET_PROPERTY", function, offset);
+    case BC_SET_PROPERTY_LONG:
+      return longConstantInstruction(H, "OP_SET_PROPERTY_LONG", function, offset);
     case BC_DESTRUCT_ARRAY:
       return byteInstruction("OP_DESTRUCT_ARRAY", function, offset);
     case BC_STRUCT_FIELD:
-      return simpleInstruction("OP_SET_STRUCT_FIELD", offset);
+      return constantInstruction(H, "OP_SET_STRUCT_FIELD", function, offset);
+    case BC_STRUCT_FIELD_LONG:
+      return longConstantInstruction(H, "OP_SET_STRUCT_FIELD_LONG", function, offset);
     case BC_EQUAL:
       return simpleInstruction("OP_EQUAL", offset);
     case BC_NOT_EQUAL:
@@ -119,6 +301,8 @@ s32 disassembleInstruction(struct hs_State* H, struct GcBcFunction* function, s3
       return simpleInstruction("OP_LESSER", offset);
     case BC_LESSER_EQUAL:
       return simpleInstruction("OP_LESSER_EQUAL", offset);
+    case BC_CONCAT:
+      return simpleInstruction("OP_CONCAT", offset);
     case BC_ADD:
       return simpleInstruction("OP_ADD", offset);
     case BC_SUBTRACT:
@@ -137,29 +321,53 @@ s32 disassembleInstruction(struct hs_State* H, struct GcBcFunction* function, s3
       return simpleInstruction("OP_NOT", offset);
     case BC_JUMP:
       return jumpInstruction("OP_JUMP", 1, function, offset);
+    case BC_JUMP_LONG:
+      return longJumpInstruction("OP_JUMP_LONG", 1, function, offset);
     case BC_JUMP_IF_FALSE:
       return jumpInstruction("OP_JUMP_IF_FALSE", 1, function, offset);
+    case BC_JUMP_IF_FALSE_LONG:
+      return longJumpInstruction("OP_JUMP_IF_FALSE_LONG", 1, function, offset);
     case BC_INEQUALITY_JUMP:
       return jumpInstruction("OP_INEQUALITY_JUMP", 1, function, offset);
+    case BC_INEQUALITY_JUMP_LONG:
+      return longJumpInstruction("OP_INEQUALITY_JUMP_LONG", 1, function, offset);
     case BC_LOOP:
       return jumpInstruction("OP_LOOP", -1, function, offset);
+    case BC_LOOP_LONG:
+      return longJumpInstruction("OP_LOOP_LONG", -1, function, offset);
+    case BC_FOR_PREP:
+      return byteInstruction("OP_FOR_PREP", function, offset);
+    case BC_FOR_PREP_LONG:
+      return shortInstruction("OP_FOR_PREP_LONG", function, offset);
+    case BC_FOR_ITER:
+      return forIterInstruction("OP_FOR_ITER", function, offset);
+    case BC_FOR_ITER_LONG:
+      return longForIterInstruction("OP_FOR_ITER_LONG", function, offset);
     case BC_CALL:
       return byteInstruction("OP_CALL", function, offset);
     case BC_INSTANCE:
       return simpleInstruction("OP_INSTANCE", offset);
-    case BC_CLOSURE: {
+    case BC_CLOSURE:
+    case BC_CLOSURE_LONG: {
       offset++;
-      u8 constant = function->bc[offset++];
-      printf("%-16s %4d ", "OP_CLOSURE", constant);
+      s32 constant = function->bc[offset++];
+      if (instruction == BC_CLOSURE_LONG) {
+        constant = (constant << 8) | function->bc[offset++];
+      }
+      printf("%-16s %4d ", opcodeName(instruction), constant);
       printValue(H, function->constants.values[constant]);
       printf("\n");
       struct GcBcFunction* inner = AS_FUNCTION(function->constants.values[constant]);
 
       for (int j = 0; j < inner->upvalueCount; j++) {
-        int isLocal = function->bc[offset++];
+        s32 start = offset;
+        int flags = function->bc[offset++];
         int index = function->bc[offset++];
+        if (flags & UPVALUE_WIDE) {
+          index = (index << 8) | function->bc[offset++];
+        }
         printf("%04d      |                     %s %d\n",
-            offset - 2, isLocal ? "local" : "upvalue", index);
+            start, flags & UPVALUE_LOCAL ? "local" : "upvalue", index);
       }
 
       return offset;
@@ -170,22 +378,41 @@ s32 disassembleInstruction(struct hs_State* H, struct GcBcFunction* function, s3
       return simpleInstruction("OP_RETURN", offset);
     case BC_ENUM:
       return constantInstruction(H, "OP_ENUM", function, offset);
-    case BC_ENUM_VALUE: {
-      u8 constant = function->bc[offset + 1];
-      u8 slot = function->bc[offset + 2];
-      printf("%-16s %4d %4d '", "OP_ENUM_VALUE", slot, constant);
+    case BC_ENUM_LONG:
+      return longConstantInstruction(H, "OP_ENUM_LONG", function, offset);
+    case BC_ENUM_VALUE:
+    case BC_ENUM_VALUE_LONG: {
+      offset++;
+      s32 constant = function->bc[offset++];
+      if (instruction == BC_ENUM_VALUE_LONG) {
+        constant = (constant << 8) | function->bc[offset++];
+      }
+      u8 slot = function->bc[offset++];
+      printf("%-16s %4d %4d '", opcodeName(instruction), slot, constant);
       printValue(H, function->constants.values[constant]);
       printf("'\n");
-      return offset + 3; 
+      return offset;
     }
     case BC_STRUCT:
       return constantInstruction(H, "OP_STRUCT", function, offset);
+    case BC_STRUCT_LONG:
+      return longConstantInstruction(H, "OP_STRUCT_LONG", function, offset);
     case BC_METHOD:
       return constantInstruction(H, "OP_METHOD", function, offset);
+    case BC_METHOD_LONG:
+      return longConstantInstruction(H, "OP_METHOD_LONG", function, offset);
     case BC_STATIC_METHOD:
       return constantInstruction(H, "OP_STATIC_METHOD", function, offset);
+    case BC_STATIC_METHOD_LONG:
+      return longConstantInstruction(H, "OP_STATIC_METHOD_LONG", function, offset);
     case BC_INVOKE:
       return invokeInstruction(H, "OP_INVOKE", function, offset);
+    case BC_INVOKE_LONG:
+      return longInvokeInstruction(H, "OP_INVOKE_LONG", function, offset);
+    case BC_YIELD:
+      return simpleInstruction("OP_YIELD", offset);
+    case BC_RESUME:
+      return byteInstruction("OP_RESUME", function, offset);
     case BC_BREAK:
       return simpleInstruction("OP_BREAK", offset);
     default:
@@ -10,5 +10,6 @@ void disassembleFunction(
 s32 disassembleInstruction(
   struct hs_State* H,
   struct GcBcFunction* function, s32 offset);
+const char* opcodeName(u8 instruction);
 
 #endif // _HOBBYSCRIPT_DEBUG_H
@@ -0,0 +1,41 @@
+#include "common.h"
+#include "hobbyscript.h"
+#include "modules.h"
+#include "object.h"
+#include "state.h"
+#include "vm.h"
+
+static Value fiber_new(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  if (!IS_CLOSURE(args[1])) {
+    runtimeError(H, "Expected a function to run in the fiber.");
+    return NEW_NIL;
+  }
+
+  struct GcClosure* function = AS_CLOSURE(args[1]);
+  if (function->function->arity > 1) {
+    runtimeError(H, "A fiber's function can take at most one argument.");
+    return NEW_NIL;
+  }
+
+  return NEW_OBJ(newFiber(H, function, FIBER_FRAMES_START, FIBER_STACK_START));
+}
+
+static Value fiber_isDone(UNUSED struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  enum FiberStatus status = AS_FIBER(args[0])->status;
+  return NEW_BOOL(status == FIBER_DONE || status == FIBER_ERROR);
+}
+
+static const struct NativeInfo fiberGlobals[] = {
+  {fiber_new, "fiber", 1},
+  {NULL, NULL, -1},
+};
+
+static const struct NativeInfo fiber[] = {
+  {fiber_isDone, "isDone", 0},
+  {NULL, NULL, -1},
+};
+
+void openFiber(struct hs_State* H) {
+  registerNatives(H, &H->globals, fiberGlobals);
+  registerNatives(H, &H->fiberMethods, fiber);
+}
@@ -3,14 +3,25 @@
 
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
 
 #define HS_VERSION_MAJOR 0
 #define HS_VERSION_MINOR 1
 #define HS_VERSION_PATCH 0
 
 struct hs_State;
+struct hs_Program;
+
+enum hs_Status {
+  HS_OK,
+  HS_RUNTIME_ERROR,
+  HS_YIELD,
+};
 
 typedef void (*hs_CFunction)(struct hs_State* H, int argCount);
+// Gives back chars passed to hs_pushExternalString().
+typedef void (*hs_ReleaseFn)(const char* chars, size_t length);
 
 struct hs_FuncInfo {
   hs_CFunction func;
@@ -18,27 +29,260 @@ struct hs_FuncInfo {
   int argCount;
 };
 
+// States share nothing, so separate states can run on separate threads. A
+// single state must only be used by one thread at a time.
 struct hs_State* hs_newState();
 void hs_freeState(struct hs_State* state);
+// Redirects print() and error reports, which default to stdout and stderr.
+void hs_setOutput(struct hs_State* H, FILE* out, FILE* err);
+
+// Budgets for untrusted scripts, all reported as runtime errors that
+// hs_pcall() can catch. Every loop iteration and function call uses one unit
+// of fuel; a negative amount (the default) means no limit. Going over the
+// memory limit (0, the default, means none) collects garbage first, and
+// fails at the next loop iteration or call if that didn't help. Buffers
+// whose size the script picks, like reserve() and f64Array(n), are checked
+// before they're allocated and fail right away instead.
+// hs_interrupt() may be called from any thread, and stops the script within
+// a few thousand loop iterations or calls.
+void hs_setFuel(struct hs_State* H, long long fuel);
+long long hs_getFuel(struct hs_State* H);
+void hs_setMemoryLimit(struct hs_State* H, size_t bytes);
+void hs_interrupt(struct hs_State* H);
+
+// Samples the running script's call stack hz times per second of CPU time,
+// from a SIGPROF timer. Only one state in the process can be profiled at a
+// time, and only on the thread that started the profiler. Returns false if
+// the profiler couldn't start. Stopping writes the samples to out (which may
+// be NULL) as folded stacks, one "outer;inner count" line per distinct
+// stack, with each frame written as function:line.
+bool hs_startProfiler(struct hs_State* H, int hz);
+void hs_stopProfiler(struct hs_State* H, FILE* out);
 
+// Attributes every allocation made while it runs to the script's call stack
+// at the time. Stopping writes a report (which may be NULL) of the objects
+// and bytes allocated at each function:line, with the share of those
+// objects that survived a collection, and the bytes allocated by each
+// distinct stack to folded (which may also be NULL) in the same format as
+// hs_stopProfiler(). Returns false if it was already running.
+bool hs_startAllocationProfiler(struct hs_State* H);
+void hs_stopAllocationProfiler(struct hs_State* H, FILE* report, FILE* folded);
+
+// Records script and native calls lasting at least minNs, every compile and
+// every garbage collection as Chrome trace events, for chrome://tracing or
+// Perfetto. Up to capacity events are kept in a buffer allocated up front;
+// later ones are dropped and counted. Timestamps come from CLOCK_MONOTONIC.
+// Stopping writes the trace as JSON to out, which may be NULL. Returns false
+// if the tracer is already running or the buffer couldn't be allocated.
+bool hs_startTrace(struct hs_State* H, size_t capacity, uint64_t minNs);
+void hs_stopTrace(struct hs_State* H, FILE* out);
+
+// Pushes a copy of the value at index, or nil if there's nothing there.
 void hs_push(struct hs_State* H, int index);
 void hs_pop(struct hs_State* H);
 
 void hs_setGlobal(struct hs_State* H, const char* name);
+// Pushes the global, or nil if it isn't defined.
+bool hs_getGlobal(struct hs_State* H, const char* name);
+
+// Calls the value below the nargs arguments on top of the stack, and
+// replaces them all with nresults values. On a runtime error hs_call()
+// prints the trace, resets the stack and returns false. hs_pcall() only
+// unwinds the call and leaves the error message on the stack instead.
+bool hs_call(struct hs_State* H, int nargs, int nresults);
+enum hs_Status hs_pcall(struct hs_State* H, int nargs, int nresults);
+
+// Replaces the function on top of the stack with a fiber that will run it.
+// Returns false and leaves the stack alone if the value isn't a script
+// function taking at most one argument. A fiber's stack starts small and
+// grows up to the main fiber's limits of 64 nested calls and 16384 slots.
+bool hs_newFiber(struct hs_State* H);
+// Resumes the fiber below the nargs (0 or 1) values on top of the stack, and
+// replaces them all with the value it yields or returns. Returns HS_YIELD if
+// the fiber suspended again and HS_OK once it finished. Errors are caught
+// like in hs_pcall(), and leave the message on the stack.
+enum hs_Status hs_resume(struct hs_State* H, int nargs);
+
+struct hs_SchedulerStats {
+  // During the last tick.
+  int tasksRun;
+  int tasksDeferred; // Ready, but left for the next tick by the budget.
+  int tasksFinished;
+  int tasksFailed;
+  uint64_t timeUsedNs;
+  // Tasks currently in each queue.
+  int ready;
+  int sleeping;
+  int waiting;
+};
+
+// Every state has a scheduler that runs fibers as tasks. A task yields nil
+// to run again next tick, a number to sleep for that many seconds, or a
+// string to wait until that signal is raised. Scripts add tasks with
+// spawn() and raise signals with signal().
+//
+// hs_spawn() queues the fiber or function on top of the stack and pops it.
+// It returns false and leaves the stack alone if the value isn't a
+// suspended fiber or a function hs_newFiber() takes, or if the fiber is
+// already a task.
+// hs_schedulerTick() runs ready tasks in order until the budget is used up,
+// but always at least one. Each task runs at most once per tick, and errors
+// only end the task that raised them.
+bool hs_spawn(struct hs_State* H);
+void hs_signal(struct hs_State* H, const char* name);
+void hs_schedulerTick(struct hs_State* H, uint64_t budgetNs);
+void hs_schedulerStats(struct hs_State* H, struct hs_SchedulerStats* stats);
+
+// The kinds of objects the collector frees.
+enum hs_ObjectType {
+  HS_OBJ_CLOSURE,
+  HS_OBJ_UPVALUE,
+  HS_OBJ_FUNCTION,
+  HS_OBJ_CFUNCTION,
+  HS_OBJ_BOUND_METHOD,
+  HS_OBJ_STRING,
+  HS_OBJ_STRUCT,
+  HS_OBJ_INSTANCE,
+  HS_OBJ_ENUM,
+  HS_OBJ_ARRAY,
+  HS_OBJ_NUM_ARRAY,
+  HS_OBJ_ARRAY_VIEW,
+  HS_OBJ_FIBER,
+  HS_OBJ_USERDATA,
+  HS_OBJ_TYPE_COUNT,
+};
+
+struct hs_GcStats {
+  // Since the state was created.
+  uint64_t collections;
+  uint64_t totalPauseNs;
+  size_t totalBytesFreed;
+  // During the last collection. Marking includes tracing.
+  uint64_t pauseNs;
+  uint64_t markNs;
+  uint64_t sweepNs;
+  size_t bytesBefore;
+  size_t bytesAfter;
+  size_t objectsFreed;
+  size_t freedByType[HS_OBJ_TYPE_COUNT];
+  // Slots in use in the string intern table, deleted ones included.
+  int stringTableCount;
+  int stringTableCapacity;
+  // The heap size that triggers the next collection.
+  size_t nextGc;
+};
+
+enum hs_GcEvent {
+  HS_GC_BEGIN,
+  HS_GC_END,
+};
+
+// Called as each collection begins and ends; at the end the stats describe
+// the collection that just finished. The callback runs in the middle of an
+// allocation, so it must not call back into the state.
+typedef void (*hs_GcCallback)(
+    struct hs_State* H, enum hs_GcEvent event, const struct hs_GcStats* stats,
+    void* userdata);
+
+void hs_gcStats(struct hs_State* H, struct hs_GcStats* stats);
+void hs_setGcCallback(struct hs_State* H, hs_GcCallback callback, void* userdata);
+
+// A program is a script compiled once, outside of any state. It is immutable,
+// so any number of states on any threads can load it at the same time, and
+// they all share its bytecode. hs_compileProgram() reports compile errors to
+// err and returns NULL. A program must outlive every state that loaded it.
+struct hs_Program* hs_compileProgram(const char* source, FILE* err);
+void hs_freeProgram(struct hs_Program* program);
+// Pushes the program's top level as a function, ready for hs_call().
+void hs_loadProgram(struct hs_State* H, const struct hs_Program* program);
+
+// Userdata keeps host data (a texture, a physics body) inline in a script
+// value, and the type decides what scripts can do with it. Every hook is
+// optional. trace reports the other userdata the payload points to with
+// hs_markUserdata(), so they stay alive. finalize releases what the payload
+// owns once it is unreachable or the state is freed, and must not use the
+// state. Methods are called with the userdata at index 0, and the list ends
+// with a NULL func.
+struct hs_UserdataType {
+  const char* name;
+  void (*trace)(struct hs_State* H, void* data);
+  void (*finalize)(void* data);
+  const struct hs_FuncInfo* methods;
+};
+
+// Pushes a new userdata and returns its payload, zeroed. The type must
+// outlive the state.
+void* hs_newUserdata(struct hs_State* H, const struct hs_UserdataType* type, size_t size);
+// Returns the payload, or NULL if the value isn't userdata of that type.
+void* hs_toUserdata(struct hs_State* H, int index, const struct hs_UserdataType* type);
+// Pushes the userdata a payload from this state belongs to.
+void hs_pushUserdata(struct hs_State* H, void* data);
+void hs_markUserdata(struct hs_State* H, void* data);
+
 void hs_registerGlobalFunctions(struct hs_State* H, struct hs_FuncInfo* funcs);
 
 void hs_pushNil(struct hs_State* H);
 void hs_pushNumber(struct hs_State* H, double v);
 void hs_pushBoolean(struct hs_State* H, bool v);
+// The string functions push nil instead of a string of INT32_MAX bytes or
+// more, after freeing an owned one or releasing an external one.
 void hs_pushString(struct hs_State* H, const char* str, size_t length);
 void hs_pushOwnedString(struct hs_State* H, char* str, size_t length);
 void hs_pushCFunction(struct hs_State* H, hs_CFunction function, int argCount);
+// Pushes a string without copying it. chars must be followed by a '\0' and
+// stay unchanged until release is called, which is when the string is
+// collected, or straight away if the state already had an equal string.
+void hs_pushExternalString(
+    struct hs_State* H, const char* chars, size_t length, hs_ReleaseFn release);
+// Strings pushed over and over, like names, can be hashed once up front.
+uint32_t hs_hashString(const char* chars, size_t length);
+void hs_pushStringHashed(
+    struct hs_State* H, const char* chars, size_t length, uint32_t hash);
 
 bool hs_isString(struct hs_State* H, int index);
+bool hs_isNumber(struct hs_State* H, int index);
 bool hs_isArray(struct hs_State* H, int index);
+bool hs_isFiber(struct hs_State* H, int index);
+
+double hs_toNumber(struct hs_State* H, int index);
+// Unlike the hs_to functions these never convert or allocate, and return
+// false if the value has another type. The chars stay valid while the string
+// is reachable.
+bool hs_getNumber(struct hs_State* H, int index, double* number);
+bool hs_getString(struct hs_State* H, int index, const char** chars, size_t* length);
 
 const char* hs_toString(struct hs_State* H, int index, size_t* length);
 
 void hs_pushArray(struct hs_State* H, int index);
 
+// Bulk exchange with script arrays. hs_newArray() pops count values into a
+// new array and pushes it, or only pushes nil if there aren't that many, and
+// hs_pushNumbers() pushes a new array of the given numbers, or nil if it
+// would go over the memory limit.
+// hs_readNumbers() copies up to count numbers from index start on, stopping
+// early at the end or at a value that isn't a number, and returns how many
+// it copied.
+void hs_newArray(struct hs_State* H, int count);
+void hs_pushNumbers(struct hs_State* H, const double* numbers, size_t count);
+size_t hs_arrayLength(struct hs_State* H, int index);
+size_t hs_readNumbers(
+    struct hs_State* H, int index, size_t start, double* out, size_t count);
+
+enum hs_NumArrayKind {
+  HS_F64,
+  HS_F32,
+  HS_I32,
+};
+
+// Number arrays (f64Array() and friends) store plain C numbers, which the
+// host can read and write in place. The storage never moves, and stays valid
+// as long as the array is reachable. hs_pushNumArray() pushes a new, zeroed
+// array; hs_toNumArray() returns NULL if the value isn't a number array of
+// that kind. hs_pushNumArray() pushes nil and returns NULL instead if the
+// kind isn't one of these, or the array would be longer than INT32_MAX or go
+// over the memory limit.
+void* hs_pushNumArray(struct hs_State* H, enum hs_NumArrayKind kind, size_t count);
+void* hs_toNumArray(
+    struct hs_State* H, int index, enum hs_NumArrayKind kind, size_t* count);
+
 #endif // _HOBBYLANG_H
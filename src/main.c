@@ -1,6 +1,14 @@
+#define _POSIX_C_SOURCE 200809L
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <stdatomic.h>
+#endif
 
 #include "common.h"
 #include "vm.h"
@@ -21,11 +29,12 @@ static void repl(struct hs_State* H) {
   }
 }
 
-static char* readFile(const char* path) {
+// Returns NULL after reporting the problem to err.
+static char* readFile(const char* path, FILE* err) {
   FILE* file = fopen(path, "rb");
   if (file == NULL) {
-    fprintf(stderr, "Could not open file \"%s\".\n", path);
-    exit(1);
+    fprintf(err, "Could not open file \"%s\".\n", path);
+    return NULL;
   }
 
   fseek(file, 0L, SEEK_END);
@@ -34,14 +43,17 @@ static char* readFile(const char* path) {
 
   char* buffer = (char*)malloc(fileSize + 1);
   if (buffer == NULL) {
-    fprintf(stderr, "Not enough memory to read \"%s\".\n", path);
-    exit(1);
+    fprintf(err, "Not enough memory to read \"%s\".\n", path);
+    fclose(file);
+    return NULL;
   }
 
   size_t bytesRead = fread(buffer, sizeof(char), fileSize, file);
   if (bytesRead < fileSize) {
-    fprintf(stderr, "Could not read file \"%s\".\n", path);
-    exit(1);
+    fprintf(err, "Could not read file \"%s\".\n", path);
+    free(buffer);
+    fclose(file);
+    return NULL;
   }
   buffer[bytesRead] = '\0';
 
@@ -49,23 +61,295 @@ static char* readFile(const char* path) {
   return buffer;
 }
 
+static s32 exitCode(enum InterpretResult result) {
+  switch (result) {
+    case INTERPRET_OK: return 0;
+    case COMPILE_ERR: return 65;
+    case RUNTIME_ERR: return 70;
+  }
+  return 1;
+}
+
+// Runs the tasks the script spawned until none are ready or sleeping. Tasks
+// still waiting for a signal by then never wake.
+static void runTasks(struct hs_State* H) {
+  struct hs_SchedulerStats stats;
+  hs_schedulerStats(H, &stats);
+  while (stats.ready > 0 || stats.sleeping > 0) {
+    if (stats.ready == 0) {
+      struct timespec pause = {0, 1000000};
+      nanosleep(&pause, NULL);
+    }
+    hs_schedulerTick(H, UINT64_MAX);
+    hs_schedulerStats(H, &stats);
+  }
+}
+
 static void runFile(struct hs_State* H, const char* path) {
-  char* source = readFile(path);
+  char* source = readFile(path, stderr);
+  if (source == NULL) {
+    exit(1);
+  }
+
   enum InterpretResult result = interpret(H, source);
   free(source);
+  if (result == INTERPRET_OK) {
+    runTasks(H);
+  }
 
-  if (result == COMPILE_ERR) {
-    exit(65);
+  s32 code = exitCode(result);
+  if (code != 0) {
+    exit(code);
   }
-  if (result == RUNTIME_ERR) {
-    exit(70);
+}
+
+#ifndef _WIN32
+
+// Batch mode runs every script in a fresh state, spread over a pool of
+// worker threads. Each script's output is captured and written out in the
+// order the scripts were given.
+
+struct BatchJob {
+  const char* path;
+  char* output;
+  size_t outputSize;
+  char* errors;
+  size_t errorsSize;
+  s32 exitCode;
+};
+
+struct Batch {
+  struct BatchJob* jobs;
+  s32 count;
+  atomic_int next;
+};
+
+static void runJob(struct BatchJob* job) {
+  FILE* out = open_memstream(&job->output, &job->outputSize);
+  FILE* err = open_memstream(&job->errors, &job->errorsSize);
+
+  char* source = readFile(job->path, err);
+  if (source == NULL) {
+    job->exitCode = 1;
+  } else {
+    struct hs_State* H = hs_newState();
+    hs_setOutput(H, out, err);
+    enum InterpretResult result = interpret(H, source);
+    if (result == INTERPRET_OK) {
+      runTasks(H);
+    }
+    job->exitCode = exitCode(result);
+    hs_freeState(H);
+    free(source);
   }
-  if (result != INTERPRET_OK) {
-    exit(1);
+
+  fclose(out);
+  fclose(err);
+}
+
+static void* batchWorker(void* arg) {
+  struct Batch* batch = arg;
+  while (true) {
+    s32 index = atomic_fetch_add(&batch->next, 1);
+    if (index >= batch->count) {
+      return NULL;
+    }
+    runJob(&batch->jobs[index]);
   }
 }
 
+// Returns the highest exit code of any script.
+static s32 runBatch(s32 workerCount, const char** paths, s32 count) {
+  struct Batch batch;
+  batch.jobs = calloc(count, sizeof(struct BatchJob));
+  batch.count = count;
+  atomic_init(&batch.next, 0);
+  for (s32 i = 0; i < count; i++) {
+    batch.jobs[i].path = paths[i];
+  }
+
+  if (workerCount > count) {
+    workerCount = count;
+  }
+  pthread_t* workers = malloc(sizeof(pthread_t) * workerCount);
+  for (s32 i = 0; i < workerCount; i++) {
+    pthread_create(&workers[i], NULL, batchWorker, &batch);
+  }
+  for (s32 i = 0; i < workerCount; i++) {
+    pthread_join(workers[i], NULL);
+  }
+  free(workers);
+
+  s32 code = 0;
+  for (s32 i = 0; i < count; i++) {
+    struct BatchJob* job = &batch.jobs[i];
+    fwrite(job->output, sizeof(char), job->outputSize, stdout);
+    fwrite(job->errors, sizeof(char), job->errorsSize, stderr);
+    free(job->output);
+    free(job->errors);
+    if (job->exitCode > code) {
+      code = job->exitCode;
+    }
+  }
+  free(batch.jobs);
+  return code;
+}
+
+#endif // _WIN32
+
+static void usage(const char* name) {
+  fprintf(stderr, "Usage: %s [path]\n", name);
+  fprintf(stderr, "       %s --jobs <count> <path>...\n", name);
+  fprintf(stderr, "       %s --profile <output> <path>\n", name);
+  fprintf(stderr, "       %s --alloc-profile <report> <folded> <path>\n", name);
+  fprintf(stderr, "       %s --trace <output> <path>\n", name);
+  exit(1);
+}
+
+#define PROFILE_HZ 1000
+
+// Runs the script under the sampling profiler and writes its folded stacks
+// to output.
+static s32 runProfiled(const char* output, const char* path) {
+  FILE* out = fopen(output, "w");
+  if (out == NULL) {
+    fprintf(stderr, "Could not open file \"%s\".\n", output);
+    return 1;
+  }
+
+  struct hs_State* H = hs_newState();
+  if (!hs_startProfiler(H, PROFILE_HZ)) {
+    fprintf(stderr, "Could not start the profiler.\n");
+    hs_freeState(H);
+    fclose(out);
+    return 1;
+  }
+
+  char* source = readFile(path, stderr);
+  s32 code = 1;
+  if (source != NULL) {
+    enum InterpretResult result = interpret(H, source);
+    free(source);
+    if (result == INTERPRET_OK) {
+      runTasks(H);
+    }
+    code = exitCode(result);
+  }
+
+  hs_stopProfiler(H, out);
+  hs_freeState(H);
+  fclose(out);
+  return code;
+}
+
+// Runs the script under the allocation profiler, writing the per-site report
+// and the folded stacks weighted by bytes to their own files.
+static s32 runAllocationProfiled(const char* reportPath, const char* foldedPath,
+    const char* path) {
+  FILE* report = fopen(reportPath, "w");
+  if (report == NULL) {
+    fprintf(stderr, "Could not open file \"%s\".\n", reportPath);
+    return 1;
+  }
+  FILE* folded = fopen(foldedPath, "w");
+  if (folded == NULL) {
+    fprintf(stderr, "Could not open file \"%s\".\n", foldedPath);
+    fclose(report);
+    return 1;
+  }
+
+  struct hs_State* H = hs_newState();
+  hs_startAllocationProfiler(H);
+
+  char* source = readFile(path, stderr);
+  s32 code = 1;
+  if (source != NULL) {
+    enum InterpretResult result = interpret(H, source);
+    free(source);
+    if (result == INTERPRET_OK) {
+      runTasks(H);
+    }
+    code = exitCode(result);
+  }
+
+  hs_stopAllocationProfiler(H, report, folded);
+  hs_freeState(H);
+  fclose(report);
+  fclose(folded);
+  return code;
+}
+
+#define TRACE_CAPACITY (1 << 20)
+#define TRACE_MIN_NS 10000
+
+// Runs the script under the tracer, leaving out calls shorter than
+// TRACE_MIN_NS, and writes the trace to output.
+static s32 runTraced(const char* output, const char* path) {
+  FILE* out = fopen(output, "w");
+  if (out == NULL) {
+    fprintf(stderr, "Could not open file \"%s\".\n", output);
+    return 1;
+  }
+
+  struct hs_State* H = hs_newState();
+  if (!hs_startTrace(H, TRACE_CAPACITY, TRACE_MIN_NS)) {
+    fprintf(stderr, "Could not start the tracer.\n");
+    hs_freeState(H);
+    fclose(out);
+    return 1;
+  }
+
+  char* source = readFile(path, stderr);
+  s32 code = 1;
+  if (source != NULL) {
+    enum InterpretResult result = interpret(H, source);
+    free(source);
+    if (result == INTERPRET_OK) {
+      runTasks(H);
+    }
+    code = exitCode(result);
+  }
+
+  hs_stopTrace(H, out);
+  hs_freeState(H);
+  fclose(out);
+  return code;
+}
+
 s32 main(s32 argc, const char* args[]) {
+  if (argc >= 2 && strcmp(args[1], "--jobs") == 0) {
+    if (argc < 4 || atoi(args[2]) < 1) {
+      usage(args[0]);
+    }
+#ifdef _WIN32
+    fprintf(stderr, "Batch mode is not supported on this platform.\n");
+    return 1;
+#else
+    return runBatch(atoi(args[2]), args + 3, argc - 3);
+#endif
+  }
+
+  if (argc >= 2 && strcmp(args[1], "--profile") == 0) {
+    if (argc != 4) {
+      usage(args[0]);
+    }
+    return runProfiled(args[2], args[3]);
+  }
+
+  if (argc >= 2 && strcmp(args[1], "--alloc-profile") == 0) {
+    if (argc != 5) {
+      usage(args[0]);
+    }
+    return runAllocationProfiled(args[2], args[3], args[4]);
+  }
+
+  if (argc >= 2 && strcmp(args[1], "--trace") == 0) {
+    if (argc != 4) {
+      usage(args[0]);
+    }
+    return runTraced(args[2], args[3]);
+  }
+
   struct hs_State* H = hs_newState();
 
   if (argc == 1) {
@@ -73,11 +357,9 @@ s32 main(s32 argc, const char* args[]) {
   } else if (argc == 2) {
     runFile(H, args[1]);
   } else {
-    fprintf(stderr, "Usage: %s [path]\n", args[0]);
-    exit(1);
+    usage(args[0]);
   }
 
   hs_freeState(H);
   return 0;
 }
-
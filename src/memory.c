@@ -1,6 +1,10 @@
+#define _POSIX_C_SOURCE 199309L
+
 #include "memory.h"
 
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
 
 #ifdef DEBUG_LOG_GC
 #include <stdio.h>
@@ -8,23 +12,64 @@
 #include "debug.h"
 #endif
 
+#include "allocprofiler.h"
 #include "object.h"
+#include "opstats.h"
 #include "compiler.h"
+#include "profiler.h"
+#include "scheduler.h"
 #include "table.h"
 #include "state.h"
+#include "tracer.h"
+#include "userdata.h"
 
 #define GC_HEAP_GROW_FACTOR 2
 
+static u64 monotonicNs() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (u64)now.tv_sec * 1000000000u + (u64)now.tv_nsec;
+}
+
+static bool overMemoryLimit(struct hs_State* H) {
+  return H->memoryLimit > 0 && H->bytesAllocated > H->memoryLimit;
+}
+
+static bool fitsMemoryLimit(struct hs_State* H, size_t bytes) {
+  return H->memoryLimit == 0
+      || (H->bytesAllocated <= H->memoryLimit
+          && bytes <= H->memoryLimit - H->bytesAllocated);
+}
+
+bool reserveMemory(struct hs_State* H, size_t bytes) {
+  if (fitsMemoryLimit(H, bytes)) {
+    return true;
+  }
+  collectGarbage(H);
+  return fitsMemoryLimit(H, bytes);
+}
+
 void* reallocate(struct hs_State* H, void* pointer, size_t oldSize, size_t newSize) {
   H->bytesAllocated += newSize - oldSize;
   if (newSize > oldSize) {
 #ifdef DEBUG_STRESS_GC
     collectGarbage(H);
 #else
-    if (H->bytesAllocated > H->nextGc) {
+    if (H->bytesAllocated > H->nextGc || overMemoryLimit(H)) {
       collectGarbage(H);
     }
 #endif
+    // The allocation still goes through, since callers can't handle it
+    // failing. The VM raises the error at its next budget check, so this
+    // only overshoots by what the VM allocates in between. Buffers sized by
+    // the script are checked up front with reserveMemory() instead.
+    if (overMemoryLimit(H)) {
+      H->memoryExceeded = true;
+      H->fuel = 0;
+    }
+    if (H->allocationProfiler != NULL) {
+      profileGrowth(H, newSize - oldSize);
+    }
   }
 
   if (newSize == 0) {
@@ -44,6 +89,10 @@ static void freeObject(struct hs_State* H, struct GcObj* object) {
   printf("%p free type %d\n", (void*)object, object->type);
 #endif
 
+  if (H->allocationProfiler != NULL) {
+    profileFree(H, object);
+  }
+
   switch (object->type) {
     case OBJ_ARRAY: {
       struct GcArray* array = (struct GcArray*)object;
@@ -51,6 +100,17 @@ static void freeObject(struct hs_State* H, struct GcObj* object) {
       FREE(H, struct GcArray, array);
       break;
     }
+    case OBJ_ARRAY_VIEW: {
+      FREE(H, struct GcArrayView, object);
+      break;
+    }
+    case OBJ_NUM_ARRAY: {
+      struct GcNumArray* array = (struct GcNumArray*)object;
+      FREE_ARRAY(
+          H, u8, array->data, numArrayElementSize(array->kind) * array->count);
+      FREE(H, struct GcNumArray, array);
+      break;
+    }
     case OBJ_ENUM: {
       struct GcEnum* enoom = (struct GcEnum*)object;
       freeTable(H, &enoom->values);
@@ -82,10 +142,18 @@ static void freeObject(struct hs_State* H, struct GcObj* object) {
       FREE(H, struct GcUpvalue, object);
       break;
     }
+    case OBJ_FIBER: {
+      struct GcFiber* fiber = (struct GcFiber*)object;
+      freeFiberStack(H, fiber);
+      FREE(H, struct GcFiber, object);
+      break;
+    }
     case OBJ_FUNCTION: {
       struct GcBcFunction* function = (struct GcBcFunction*)object;
-      FREE_ARRAY(H, u8, function->bc, function->bcCapacity);
-      FREE_ARRAY(H, s32, function->lines, function->bcCapacity);
+      if (!function->sharedCode) {
+        FREE_ARRAY(H, u8, function->bc, function->bcCapacity);
+        FREE_ARRAY(H, u8, function->lineInfo, function->lineInfoCapacity);
+      }
       freeValueArray(H, &function->constants);
       FREE(H, struct GcBcFunction, object);
       break;
@@ -98,9 +166,21 @@ static void freeObject(struct hs_State* H, struct GcObj* object) {
       FREE(H, struct GcCFunction, object);
       break;
     }
+    case OBJ_USERDATA: {
+      struct GcUserdata* userdata = (struct GcUserdata*)object;
+      if (userdata->cls->type->finalize != NULL) {
+        userdata->cls->type->finalize(userdata->data);
+      }
+      reallocate(H, object, sizeof(struct GcUserdata) + userdata->size, 0);
+      break;
+    }
     case OBJ_STRING: {
       struct GcString* string = (struct GcString*)object;
-      FREE_ARRAY(H, char, string->chars, string->length + 1);
+      if (string->release != NULL) {
+        string->release(string->chars, string->length);
+      } else {
+        FREE_ARRAY(H, char, string->chars, string->length + 1);
+      }
       FREE(H, struct GcString, object);
       break;
     }
@@ -148,6 +228,24 @@ static void markArray(struct hs_State* H, struct ValueArray* array) {
   }
 }
 
+static void markStack(
+    struct hs_State* H, Value* stack, Value* stackTop,
+    struct CallFrame* frames, s32 frameCount, struct GcUpvalue* openUpvalues) {
+  for (Value* slot = stack; slot < stackTop; slot++) {
+    markValue(H, *slot);
+  }
+
+  for (s32 i = 0; i < frameCount; i++) {
+    markObject(H, (struct GcObj*)frames[i].func);
+  }
+
+  for (struct GcUpvalue* upvalue = openUpvalues;
+      upvalue != NULL;
+      upvalue = upvalue->next) {
+    markObject(H, (struct GcObj*)upvalue);
+  }
+}
+
 static void blackenObject(struct hs_State* H, struct GcObj* object) {
 #ifdef DEBUG_LOG_GC
   printf("%p blacken ", (void*)object);
@@ -157,12 +255,18 @@ static void blackenObject(struct hs_State* H, struct GcObj* object) {
 
   switch (object->type) {
     // No references.
-    case OBJ_CFUNCTION:
     case OBJ_STRING:
+    case OBJ_NUM_ARRAY:
       break;
-    case OBJ_UPVALUE:
-      markValue(H, ((struct GcUpvalue*)object)->closed);
+    case OBJ_CFUNCTION:
+      markObject(H, (struct GcObj*)((struct GcCFunction*)object)->name);
       break;
+    case OBJ_UPVALUE: {
+      struct GcUpvalue* upvalue = (struct GcUpvalue*)object;
+      markValue(H, upvalue->closed);
+      markObject(H, (struct GcObj*)upvalue->fiber);
+      break;
+    }
     case OBJ_FUNCTION: {
       struct GcBcFunction* function = (struct GcBcFunction*)object;
       markObject(H, (struct GcObj*)function->name);
@@ -208,26 +312,45 @@ static void blackenObject(struct hs_State* H, struct GcObj* object) {
       markArray(H, &array->values);
       break;
     }
+    case OBJ_ARRAY_VIEW: {
+      struct GcArrayView* view = (struct GcArrayView*)object;
+      markObject(H, (struct GcObj*)view->parent);
+      break;
+    }
+    case OBJ_FIBER: {
+      struct GcFiber* fiber = (struct GcFiber*)object;
+      markObject(H, (struct GcObj*)fiber->function);
+      markObject(H, (struct GcObj*)fiber->caller);
+      // The running fiber's stack is marked from the state's registers, its
+      // saved copy is stale.
+      if (fiber != H->fiber) {
+        markStack(H, fiber->stack, fiber->stackTop,
+            fiber->frames, fiber->frameCount, fiber->openUpvalues);
+      }
+      break;
+    }
+    case OBJ_USERDATA: {
+      struct GcUserdata* userdata = (struct GcUserdata*)object;
+      if (userdata->cls->type->trace != NULL) {
+        userdata->cls->type->trace(H, userdata->data);
+      }
+      break;
+    }
   }
 }
 
 static void markRoots(struct hs_State* H) {
-  for (Value* slot = H->stack; slot < H->stackTop; slot++) {
-    markValue(H, *slot);
-  }
-
-  for (s32 i = 0; i < H->frameCount; i++) {
-    markObject(H, (struct GcObj*)H->frames[i].func);
-  }
-
-  for (struct GcUpvalue* upvalue = H->openUpvalues;
-      upvalue != NULL;
-      upvalue = upvalue->next) {
-    markObject(H, (struct GcObj*)upvalue);
-  }
+  markStack(H, H->stack, H->stackTop, H->frames, H->frameCount, H->openUpvalues);
+  markObject(H, (struct GcObj*)H->fiber);
+  markObject(H, (struct GcObj*)H->mainFiber);
 
   markTable(H, &H->globals);
+  markTable(H, &H->arrayMethods);
+  markTable(H, &H->numArrayMethods);
+  markTable(H, &H->fiberMethods);
   markCompilerRoots(H, H->parser);
+  markScheduler(H, H->scheduler);
+  markUserdataClasses(H);
 }
 
 static void traceReferences(struct hs_State* H) {
@@ -255,6 +378,8 @@ static void sweep(struct hs_State* H) {
         H->objects = current;
       }
 
+      H->gcStats.objectsFreed++;
+      H->gcStats.freedByType[unreached->type]++;
       freeObject(H, unreached);
     }
   }
@@ -266,13 +391,55 @@ void collectGarbage(struct hs_State* H) {
   size_t before = H->bytesAllocated;
 #endif
 
+  // Samples still in the profiler's buffer may point at functions about to
+  // be freed.
+  if (H->profiler != NULL) {
+    drainProfiler(H->profiler);
+  }
+
+  struct hs_GcStats* stats = &H->gcStats;
+  if (H->gcCallback != NULL) {
+    H->gcCallback(H, HS_GC_BEGIN, stats, H->gcCallbackData);
+  }
+  u64 start = monotonicNs();
+  stats->bytesBefore = H->bytesAllocated;
+  stats->objectsFreed = 0;
+  memset(stats->freedByType, 0, sizeof(stats->freedByType));
+
   markRoots(H);
   traceReferences(H);
+  u64 marked = monotonicNs();
   tableRemoveUnmarked(&H->strings);
+#ifdef DEBUG_OPCODE_STATS
+  saveFunctionStats(H->opcodeStats, H->objects, true);
+#endif
   sweep(H);
+  if (H->allocationProfiler != NULL) {
+    profileCollection(H);
+  }
 
   H->nextGc = H->bytesAllocated * GC_HEAP_GROW_FACTOR;
 
+  u64 end = monotonicNs();
+  stats->collections++;
+  stats->markNs = marked - start;
+  stats->sweepNs = end - marked;
+  stats->pauseNs = end - start;
+  stats->totalPauseNs += stats->pauseNs;
+  stats->bytesAfter = H->bytesAllocated;
+  stats->totalBytesFreed += stats->bytesBefore - stats->bytesAfter;
+  stats->stringTableCount = H->strings.count;
+  stats->stringTableCapacity = H->strings.capacity;
+  stats->nextGc = H->nextGc;
+  if (H->tracer != NULL) {
+    traceSpan(H->tracer, "gc", "collectGarbage", start, end);
+    traceSpan(H->tracer, "gc", "mark", start, marked);
+    traceSpan(H->tracer, "gc", "sweep", marked, end);
+  }
+  if (H->gcCallback != NULL) {
+    H->gcCallback(H, HS_GC_END, stats, H->gcCallbackData);
+  }
+
 #ifdef DEBUG_LOG_GC
   printf("Collected %zu bytes (from %zu to %zu) next at %zu.\n",
       before - H->bytesAllocated, before, H->bytesAllocated, H->nextGc);
@@ -15,6 +15,9 @@
     reallocate(H, pointer, sizeof(type) * (oldCount), 0)
 
 void* reallocate(struct hs_State* H, void* pointer, size_t oldSize, size_t newSize);
+// Whether bytes more can be allocated without going over the memory limit,
+// collecting garbage first if that's what it takes.
+bool reserveMemory(struct hs_State* H, size_t bytes);
 void markObject(struct hs_State* H, struct GcObj* object);
 void markValue(struct hs_State* H, Value value);
 void collectGarbage(struct hs_State* H);
@@ -4,7 +4,28 @@
 #include "state.h"
 #include "hobbyscript.h"
 
+struct NativeInfo {
+  NativeFn native;
+  const char* name;
+  s32 arity;
+};
+
+// Only one of unary and binary is set.
+struct NumberNativeInfo {
+  NumberFn1 unary;
+  NumberFn2 binary;
+  const char* name;
+};
+
+void registerNatives(
+    struct hs_State* H, struct Table* table, const struct NativeInfo* natives);
+void registerNumberNatives(
+    struct hs_State* H, struct Table* table, const struct NumberNativeInfo* natives);
+
 void openCore(struct hs_State* H);
 void openArray(struct hs_State* H);
+void openNumArray(struct hs_State* H);
+void openFiber(struct hs_State* H);
+void openScheduler(struct hs_State* H);
 
 #endif // _HOBBYSCRIPT_MODULES_H
@@ -0,0 +1,575 @@
+#include "common.h"
+#include "hobbyscript.h"
+#include "memory.h"
+#include "modules.h"
+#include "object.h"
+#include "table.h"
+#include "state.h"
+#include "vm.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define HAS_X86_SIMD
+#include <immintrin.h>
+#include <stdatomic.h>
+#endif
+
+// f64 kernels. Every kernel has a scalar version; on x86 there are also SSE2
+// and AVX versions, picked at runtime based on what the CPU supports.
+
+struct F64Kernels {
+  f64 (*sum)(const f64* a, s32 n);
+  f64 (*dot)(const f64* a, const f64* b, s32 n);
+  void (*scale)(f64* a, f64 k, s32 n);
+  void (*add)(f64* a, const f64* b, s32 n);
+  f64 (*min)(const f64* a, s32 n);
+  f64 (*max)(const f64* a, s32 n);
+  void (*clamp)(f64* a, f64 lo, f64 hi, s32 n);
+  void (*lerp)(f64* a, const f64* b, f64 t, s32 n);
+};
+
+static f64 scalarSum(const f64* a, s32 n) {
+  f64 sum = 0;
+  for (s32 i = 0; i < n; i++) {
+    sum += a[i];
+  }
+  return sum;
+}
+
+static f64 scalarDot(const f64* a, const f64* b, s32 n) {
+  f64 sum = 0;
+  for (s32 i = 0; i < n; i++) {
+    sum += a[i] * b[i];
+  }
+  return sum;
+}
+
+static void scalarScale(f64* a, f64 k, s32 n) {
+  for (s32 i = 0; i < n; i++) {
+    a[i] *= k;
+  }
+}
+
+static void scalarAdd(f64* a, const f64* b, s32 n) {
+  for (s32 i = 0; i < n; i++) {
+    a[i] += b[i];
+  }
+}
+
+static f64 scalarMin(const f64* a, s32 n) {
+  f64 min = a[0];
+  for (s32 i = 1; i < n; i++) {
+    min = a[i] < min ? a[i] : min;
+  }
+  return min;
+}
+
+static f64 scalarMax(const f64* a, s32 n) {
+  f64 max = a[0];
+  for (s32 i = 1; i < n; i++) {
+    max = a[i] > max ? a[i] : max;
+  }
+  return max;
+}
+
+static void scalarClamp(f64* a, f64 lo, f64 hi, s32 n) {
+  for (s32 i = 0; i < n; i++) {
+    f64 v = a[i] < lo ? lo : a[i];
+    a[i] = v > hi ? hi : v;
+  }
+}
+
+static void scalarLerp(f64* a, const f64* b, f64 t, s32 n) {
+  for (s32 i = 0; i < n; i++) {
+    a[i] += (b[i] - a[i]) * t;
+  }
+}
+
+#ifndef HAS_X86_SIMD
+
+static const struct F64Kernels scalarKernels = {
+  scalarSum, scalarDot, scalarScale, scalarAdd,
+  scalarMin, scalarMax, scalarClamp, scalarLerp,
+};
+
+#else
+
+static f64 sse2Sum(const f64* a, s32 n) {
+  __m128d acc = _mm_setzero_pd();
+  s32 i = 0;
+  for (; i + 2 <= n; i += 2) {
+    acc = _mm_add_pd(acc, _mm_loadu_pd(a + i));
+  }
+  f64 lanes[2];
+  _mm_storeu_pd(lanes, acc);
+  return lanes[0] + lanes[1] + scalarSum(a + i, n - i);
+}
+
+static f64 sse2Dot(const f64* a, const f64* b, s32 n) {
+  __m128d acc = _mm_setzero_pd();
+  s32 i = 0;
+  for (; i + 2 <= n; i += 2) {
+    acc = _mm_add_pd(acc, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+  }
+  f64 lanes[2];
+  _mm_storeu_pd(lanes, acc);
+  return lanes[0] + lanes[1] + scalarDot(a + i, b + i, n - i);
+}
+
+static void sse2Scale(f64* a, f64 k, s32 n) {
+  __m128d vk = _mm_set1_pd(k);
+  s32 i = 0;
+  for (; i + 2 <= n; i += 2) {
+    _mm_storeu_pd(a + i, _mm_mul_pd(_mm_loadu_pd(a + i), vk));
+  }
+  scalarScale(a + i, k, n - i);
+}
+
+static void sse2Add(f64* a, const f64* b, s32 n) {
+  s32 i = 0;
+  for (; i + 2 <= n; i += 2) {
+    _mm_storeu_pd(a + i, _mm_add_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+  }
+  scalarAdd(a + i, b + i, n - i);
+}
+
+static f64 sse2Min(const f64* a, s32 n) {
+  if (n < 2) {
+    return scalarMin(a, n);
+  }
+
+  __m128d acc = _mm_loadu_pd(a);
+  s32 i = 2;
+  for (; i + 2 <= n; i += 2) {
+    acc = _mm_min_pd(acc, _mm_loadu_pd(a + i));
+  }
+  f64 lanes[2];
+  _mm_storeu_pd(lanes, acc);
+  f64 min = lanes[0] < lanes[1] ? lanes[0] : lanes[1];
+  for (; i < n; i++) {
+    min = a[i] < min ? a[i] : min;
+  }
+  return min;
+}
+
+static f64 sse2Max(const f64* a, s32 n) {
+  if (n < 2) {
+    return scalarMax(a, n);
+  }
+
+  __m128d acc = _mm_loadu_pd(a);
+  s32 i = 2;
+  for (; i + 2 <= n; i += 2) {
+    acc = _mm_max_pd(acc, _mm_loadu_pd(a + i));
+  }
+  f64 lanes[2];
+  _mm_storeu_pd(lanes, acc);
+  f64 max = lanes[0] > lanes[1] ? lanes[0] : lanes[1];
+  for (; i < n; i++) {
+    max = a[i] > max ? a[i] : max;
+  }
+  return max;
+}
+
+static void sse2Clamp(f64* a, f64 lo, f64 hi, s32 n) {
+  __m128d vlo = _mm_set1_pd(lo);
+  __m128d vhi = _mm_set1_pd(hi);
+  s32 i = 0;
+  for (; i + 2 <= n; i += 2) {
+    __m128d v = _mm_max_pd(_mm_loadu_pd(a + i), vlo);
+    _mm_storeu_pd(a + i, _mm_min_pd(v, vhi));
+  }
+  scalarClamp(a + i, lo, hi, n - i);
+}
+
+static void sse2Lerp(f64* a, const f64* b, f64 t, s32 n) {
+  __m128d vt = _mm_set1_pd(t);
+  s32 i = 0;
+  for (; i + 2 <= n; i += 2) {
+    __m128d va = _mm_loadu_pd(a + i);
+    __m128d diff = _mm_sub_pd(_mm_loadu_pd(b + i), va);
+    _mm_storeu_pd(a + i, _mm_add_pd(va, _mm_mul_pd(diff, vt)));
+  }
+  scalarLerp(a + i, b + i, t, n - i);
+}
+
+static const struct F64Kernels sse2Kernels = {
+  sse2Sum, sse2Dot, sse2Scale, sse2Add,
+  sse2Min, sse2Max, sse2Clamp, sse2Lerp,
+};
+
+#define AVX __attribute__((target("avx")))
+
+AVX static f64 avxHorizontalSum(__m256d v) {
+  f64 lanes[4];
+  _mm256_storeu_pd(lanes, v);
+  return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+}
+
+AVX static f64 avxSum(const f64* a, s32 n) {
+  __m256d acc = _mm256_setzero_pd();
+  s32 i = 0;
+  for (; i + 4 <= n; i += 4) {
+    acc = _mm256_add_pd(acc, _mm256_loadu_pd(a + i));
+  }
+  return avxHorizontalSum(acc) + scalarSum(a + i, n - i);
+}
+
+AVX static f64 avxDot(const f64* a, const f64* b, s32 n) {
+  __m256d acc = _mm256_setzero_pd();
+  s32 i = 0;
+  for (; i + 4 <= n; i += 4) {
+    acc = _mm256_add_pd(
+        acc, _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+  }
+  return avxHorizontalSum(acc) + scalarDot(a + i, b + i, n - i);
+}
+
+AVX static void avxScale(f64* a, f64 k, s32 n) {
+  __m256d vk = _mm256_set1_pd(k);
+  s32 i = 0;
+  for (; i + 4 <= n; i += 4) {
+    _mm256_storeu_pd(a + i, _mm256_mul_pd(_mm256_loadu_pd(a + i), vk));
+  }
+  scalarScale(a + i, k, n - i);
+}
+
+AVX static void avxAdd(f64* a, const f64* b, s32 n) {
+  s32 i = 0;
+  for (; i + 4 <= n; i += 4) {
+    _mm256_storeu_pd(
+        a + i, _mm256_add_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+  }
+  scalarAdd(a + i, b + i, n - i);
+}
+
+AVX static f64 avxMin(const f64* a, s32 n) {
+  if (n < 4) {
+    return scalarMin(a, n);
+  }
+
+  __m256d acc = _mm256_loadu_pd(a);
+  s32 i = 4;
+  for (; i + 4 <= n; i += 4) {
+    acc = _mm256_min_pd(acc, _mm256_loadu_pd(a + i));
+  }
+  f64 lanes[4];
+  _mm256_storeu_pd(lanes, acc);
+  f64 min = scalarMin(lanes, 4);
+  for (; i < n; i++) {
+    min = a[i] < min ? a[i] : min;
+  }
+  return min;
+}
+
+AVX static f64 avxMax(const f64* a, s32 n) {
+  if (n < 4) {
+    return scalarMax(a, n);
+  }
+
+  __m256d acc = _mm256_loadu_pd(a);
+  s32 i = 4;
+  for (; i + 4 <= n; i += 4) {
+    acc = _mm256_max_pd(acc, _mm256_loadu_pd(a + i));
+  }
+  f64 lanes[4];
+  _mm256_storeu_pd(lanes, acc);
+  f64 max = scalarMax(lanes, 4);
+  for (; i < n; i++) {
+    max = a[i] > max ? a[i] : max;
+  }
+  return max;
+}
+
+AVX static void avxClamp(f64* a, f64 lo, f64 hi, s32 n) {
+  __m256d vlo = _mm256_set1_pd(lo);
+  __m256d vhi = _mm256_set1_pd(hi);
+  s32 i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m256d v = _mm256_max_pd(_mm256_loadu_pd(a + i), vlo);
+    _mm256_storeu_pd(a + i, _mm256_min_pd(v, vhi));
+  }
+  scalarClamp(a + i, lo, hi, n - i);
+}
+
+AVX static void avxLerp(f64* a, const f64* b, f64 t, s32 n) {
+  __m256d vt = _mm256_set1_pd(t);
+  s32 i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m256d va = _mm256_loadu_pd(a + i);
+    __m256d diff = _mm256_sub_pd(_mm256_loadu_pd(b + i), va);
+    _mm256_storeu_pd(a + i, _mm256_add_pd(va, _mm256_mul_pd(diff, vt)));
+  }
+  scalarLerp(a + i, b + i, t, n - i);
+}
+
+#undef AVX
+
+static const struct F64Kernels avxKernels = {
+  avxSum, avxDot, avxScale, avxAdd,
+  avxMin, avxMax, avxClamp, avxLerp,
+};
+
+#endif // HAS_X86_SIMD
+
+#ifdef HAS_X86_SIMD
+// Picked on the first call. States on other threads may race to store it,
+// but they all store the same pointer.
+static _Atomic(const struct F64Kernels*) pickedKernels = NULL;
+
+static const struct F64Kernels* f64Kernels() {
+  const struct F64Kernels* kernels =
+      atomic_load_explicit(&pickedKernels, memory_order_relaxed);
+  if (kernels == NULL) {
+    kernels = __builtin_cpu_supports("avx") ? &avxKernels : &sse2Kernels;
+    atomic_store_explicit(&pickedKernels, kernels, memory_order_relaxed);
+  }
+  return kernels;
+}
+#else
+static const struct F64Kernels* f64Kernels() {
+  return &scalarKernels;
+}
+#endif
+
+static struct GcNumArray* toNumArray(Value value) {
+  return IS_NUM_ARRAY(value) ? AS_NUM_ARRAY(value) : NULL;
+}
+
+static bool sameShape(struct GcNumArray* a, struct GcNumArray* b) {
+  return b != NULL && a->kind == b->kind && a->count == b->count;
+}
+
+static Value createNumArray(struct hs_State* H, enum NumArrayKind kind, Value arg) {
+  if (IS_NUMBER(arg)) {
+    f64 length = AS_NUMBER(arg);
+    if (length != length) {
+      runtimeError(H, "Number array length must be a number, not NaN.");
+      return NEW_NIL;
+    }
+    if (length < 0) {
+      runtimeError(H, "Number array length cannot be negative.");
+      return NEW_NIL;
+    }
+    // Checked before converting, since a length past the s32 range can't be
+    // converted.
+    if (length > INT32_MAX) {
+      runtimeError(H, "Out of memory.");
+      return NEW_NIL;
+    }
+    s32 count = (s32)length;
+    if (!reserveMemory(H, numArrayElementSize(kind) * (size_t)count)) {
+      runtimeError(H, "Out of memory.");
+      return NEW_NIL;
+    }
+    return NEW_OBJ(newNumArray(H, kind, count));
+  }
+
+  if (IS_ARRAY(arg)) {
+    struct GcArray* source = AS_ARRAY(arg);
+    for (s32 i = 0; i < source->values.count; i++) {
+      if (!IS_NUMBER(source->values.values[i])) {
+        runtimeError(H, "Number arrays can only be created from numbers.");
+        return NEW_NIL;
+      }
+    }
+
+    struct GcNumArray* array = newNumArray(H, kind, source->values.count);
+    for (s32 i = 0; i < array->count; i++) {
+      numArraySet(array, i, AS_NUMBER(source->values.values[i]));
+    }
+    return NEW_OBJ(array);
+  }
+
+  runtimeError(H, "Expected a length or an array.");
+  return NEW_NIL;
+}
+
+static Value numarray_f64Array(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  return createNumArray(H, NUM_ARRAY_F64, args[1]);
+}
+
+static Value numarray_f32Array(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  return createNumArray(H, NUM_ARRAY_F32, args[1]);
+}
+
+static Value numarray_i32Array(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  return createNumArray(H, NUM_ARRAY_I32, args[1]);
+}
+
+static Value numarray_len(UNUSED struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  return NEW_NUMBER(toNumArray(args[0])->count);
+}
+
+static Value numarray_sum(UNUSED struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  struct GcNumArray* a = toNumArray(args[0]);
+  if (a->kind == NUM_ARRAY_F64) {
+    return NEW_NUMBER(f64Kernels()->sum(a->data, a->count));
+  }
+
+  f64 sum = 0;
+  for (s32 i = 0; i < a->count; i++) {
+    sum += numArrayGet(a, i);
+  }
+  return NEW_NUMBER(sum);
+}
+
+static Value numarray_dot(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  struct GcNumArray* a = toNumArray(args[0]);
+  struct GcNumArray* b = toNumArray(args[1]);
+  if (!sameShape(a, b)) {
+    runtimeError(H, "Expected a number array of the same kind and length.");
+    return NEW_NIL;
+  }
+
+  if (a->kind == NUM_ARRAY_F64) {
+    return NEW_NUMBER(f64Kernels()->dot(a->data, b->data, a->count));
+  }
+
+  f64 sum = 0;
+  for (s32 i = 0; i < a->count; i++) {
+    sum += numArrayGet(a, i) * numArrayGet(b, i);
+  }
+  return NEW_NUMBER(sum);
+}
+
+static Value numarray_scale(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  struct GcNumArray* a = toNumArray(args[0]);
+  if (!IS_NUMBER(args[1])) {
+    runtimeError(H, "Expected a number.");
+    return NEW_NIL;
+  }
+  f64 k = AS_NUMBER(args[1]);
+
+  if (a->kind == NUM_ARRAY_F64) {
+    f64Kernels()->scale(a->data, k, a->count);
+  } else {
+    for (s32 i = 0; i < a->count; i++) {
+      numArraySet(a, i, numArrayGet(a, i) * k);
+    }
+  }
+  return NEW_NIL;
+}
+
+static Value numarray_add(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  struct GcNumArray* a = toNumArray(args[0]);
+  struct GcNumArray* b = toNumArray(args[1]);
+  if (!sameShape(a, b)) {
+    runtimeError(H, "Expected a number array of the same kind and length.");
+    return NEW_NIL;
+  }
+
+  if (a->kind == NUM_ARRAY_F64) {
+    f64Kernels()->add(a->data, b->data, a->count);
+  } else {
+    for (s32 i = 0; i < a->count; i++) {
+      numArraySet(a, i, numArrayGet(a, i) + numArrayGet(b, i));
+    }
+  }
+  return NEW_NIL;
+}
+
+static Value numarray_min(UNUSED struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  struct GcNumArray* a = toNumArray(args[0]);
+  if (a->count == 0) {
+    return NEW_NIL;
+  }
+
+  if (a->kind == NUM_ARRAY_F64) {
+    return NEW_NUMBER(f64Kernels()->min(a->data, a->count));
+  }
+
+  f64 min = numArrayGet(a, 0);
+  for (s32 i = 1; i < a->count; i++) {
+    f64 v = numArrayGet(a, i);
+    min = v < min ? v : min;
+  }
+  return NEW_NUMBER(min);
+}
+
+static Value numarray_max(UNUSED struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  struct GcNumArray* a = toNumArray(args[0]);
+  if (a->count == 0) {
+    return NEW_NIL;
+  }
+
+  if (a->kind == NUM_ARRAY_F64) {
+    return NEW_NUMBER(f64Kernels()->max(a->data, a->count));
+  }
+
+  f64 max = numArrayGet(a, 0);
+  for (s32 i = 1; i < a->count; i++) {
+    f64 v = numArrayGet(a, i);
+    max = v > max ? v : max;
+  }
+  return NEW_NUMBER(max);
+}
+
+static Value numarray_clamp(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  struct GcNumArray* a = toNumArray(args[0]);
+  if (!IS_NUMBER(args[1]) || !IS_NUMBER(args[2])) {
+    runtimeError(H, "Expected numbers.");
+    return NEW_NIL;
+  }
+  f64 lo = AS_NUMBER(args[1]);
+  f64 hi = AS_NUMBER(args[2]);
+
+  if (a->kind == NUM_ARRAY_F64) {
+    f64Kernels()->clamp(a->data, lo, hi, a->count);
+  } else {
+    for (s32 i = 0; i < a->count; i++) {
+      f64 v = numArrayGet(a, i);
+      v = v < lo ? lo : v;
+      numArraySet(a, i, v > hi ? hi : v);
+    }
+  }
+  return NEW_NIL;
+}
+
+static Value numarray_lerp(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  struct GcNumArray* a = toNumArray(args[0]);
+  struct GcNumArray* b = toNumArray(args[1]);
+  if (!sameShape(a, b)) {
+    runtimeError(H, "Expected a number array of the same kind and length.");
+    return NEW_NIL;
+  }
+  if (!IS_NUMBER(args[2])) {
+    runtimeError(H, "Expected a number.");
+    return NEW_NIL;
+  }
+  f64 t = AS_NUMBER(args[2]);
+
+  if (a->kind == NUM_ARRAY_F64) {
+    f64Kernels()->lerp(a->data, b->data, t, a->count);
+  } else {
+    for (s32 i = 0; i < a->count; i++) {
+      f64 v = numArrayGet(a, i);
+      numArraySet(a, i, v + (numArrayGet(b, i) - v) * t);
+    }
+  }
+  return NEW_NIL;
+}
+
+static const struct NativeInfo numArrayGlobals[] = {
+  {numarray_f64Array, "f64Array", 1},
+  {numarray_f32Array, "f32Array", 1},
+  {numarray_i32Array, "i32Array", 1},
+  {NULL, NULL, -1},
+};
+
+static const struct NativeInfo numArray[] = {
+  {numarray_len, "len", 0},
+  {numarray_sum, "sum", 0},
+  {numarray_dot, "dot", 1},
+  {numarray_scale, "scale", 1},
+  {numarray_add, "add", 1},
+  {numarray_min, "min", 0},
+  {numarray_max, "max", 0},
+  {numarray_clamp, "clamp", 2},
+  {numarray_lerp, "lerp", 2},
+  {NULL, NULL, -1},
+};
+
+void openNumArray(struct hs_State* H) {
+  registerNatives(H, &H->globals, numArrayGlobals);
+  registerNatives(H, &H->numArrayMethods, numArray);
+}
@@ -4,6 +4,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "allocprofiler.h"
 #include "memory.h"
 #include "table.h"
 #include "state.h"
@@ -18,6 +19,9 @@ static struct GcObj* allocateObject(struct hs_State* H, size_t size, enum ObjTyp
   
   object->next = H->objects;
   H->objects = object;
+  if (H->allocationProfiler != NULL) {
+    profileObject(H, object);
+  }
 
 #ifdef DEBUG_LOG_GC
   printf("%p allocate %zu for %d\n", (void*)object, size, type);
@@ -32,6 +36,78 @@ struct GcArray* newArray(struct hs_State* H) {
   return array;
 }
 
+struct GcArrayView* newArrayView(
+    struct hs_State* H, struct GcArray* parent, s32 start, s32 length) {
+  struct GcArrayView* view = ALLOCATE_OBJ(H, struct GcArrayView, OBJ_ARRAY_VIEW);
+  view->parent = parent;
+  view->start = start;
+  view->length = length;
+  return view;
+}
+
+s32 arrayViewCount(struct GcArrayView* view) {
+  s32 available = view->parent->values.count - view->start;
+  if (available < 0) {
+    return 0;
+  }
+  return available < view->length ? available : view->length;
+}
+
+struct GcNumArray* newNumArray(struct hs_State* H, enum NumArrayKind kind, s32 count) {
+  // The buffer is allocated first so a collection triggered by it can't
+  // sweep the array before it's reachable.
+  size_t size = numArrayElementSize(kind) * count;
+  void* data = ALLOCATE(H, u8, size);
+  memset(data, 0, size);
+
+  struct GcNumArray* array = ALLOCATE_OBJ(H, struct GcNumArray, OBJ_NUM_ARRAY);
+  array->kind = kind;
+  array->count = count;
+  array->data = data;
+  return array;
+}
+
+size_t numArrayElementSize(enum NumArrayKind kind) {
+  switch (kind) {
+    case NUM_ARRAY_F64: return sizeof(f64);
+    case NUM_ARRAY_F32: return sizeof(f32);
+    case NUM_ARRAY_I32: return sizeof(s32);
+  }
+  return 0;
+}
+
+f64 numArrayGet(struct GcNumArray* array, s32 index) {
+  switch (array->kind) {
+    case NUM_ARRAY_F64: return ((f64*)array->data)[index];
+    case NUM_ARRAY_F32: return ((f32*)array->data)[index];
+    case NUM_ARRAY_I32: return ((s32*)array->data)[index];
+  }
+  return 0;
+}
+
+// Converting a number outside the s32 range is undefined, so it saturates
+// instead, and NaN stores 0.
+static s32 toS32(f64 value) {
+  if (value != value) {
+    return 0;
+  }
+  if (value <= INT32_MIN) {
+    return INT32_MIN;
+  }
+  if (value >= INT32_MAX) {
+    return INT32_MAX;
+  }
+  return (s32)value;
+}
+
+void numArraySet(struct GcNumArray* array, s32 index, f64 value) {
+  switch (array->kind) {
+    case NUM_ARRAY_F64: ((f64*)array->data)[index] = value; break;
+    case NUM_ARRAY_F32: ((f32*)array->data)[index] = (f32)value; break;
+    case NUM_ARRAY_I32: ((s32*)array->data)[index] = toS32(value); break;
+  }
+}
+
 struct GcEnum* newEnum(struct hs_State* H, struct GcString* name) {
   struct GcEnum* enoom = ALLOCATE_OBJ(H, struct GcEnum, OBJ_ENUM);
   enoom->name = name;
@@ -39,6 +115,16 @@ struct GcEnum* newEnum(struct hs_State* H, struct GcString* name) {
   return enoom;
 }
 
+struct GcUserdata* newUserdata(
+    struct hs_State* H, struct UserdataClass* cls, size_t size) {
+  struct GcUserdata* userdata = (struct GcUserdata*)allocateObject(
+      H, sizeof(struct GcUserdata) + size, OBJ_USERDATA);
+  userdata->cls = cls;
+  userdata->size = size;
+  memset(userdata->data, 0, size);
+  return userdata;
+}
+
 struct GcBoundMethod* newBoundMethod(
     struct hs_State* H, Value receiver, struct GcClosure* method) {
   struct GcBoundMethod* bound = ALLOCATE_OBJ(H, struct GcBoundMethod, OBJ_BOUND_METHOD);
@@ -61,7 +147,10 @@ struct GcInstance* newInstance(struct hs_State* H, struct GcStruct* strooct) {
   struct GcInstance* instance = ALLOCATE_OBJ(H, struct GcInstance, OBJ_INSTANCE);
   instance->strooct = strooct;
   initTable(&instance->fields);
+  // Copying the defaults allocates, and the instance isn't reachable yet.
+  push(H, NEW_OBJ(instance));
   copyTable(H, &instance->fields, &strooct->defaultFields);
+  pop(H);
   return instance;
 }
 
@@ -84,20 +173,68 @@ struct GcUpvalue* newUpvalue(struct hs_State* H, Value* slot) {
   upvalue->location = slot;
   upvalue->closed = NEW_NIL;
   upvalue->next = NULL;
+  upvalue->fiber = H->fiber;
   return upvalue;
 }
 
+// The stack and frames are allocated on the first resume, so fibers that
+// are created but never run stay small. The capacities are where they start.
+struct GcFiber* newFiber(struct hs_State* H, struct GcClosure* function,
+    s32 frameCapacity, s32 stackCapacity) {
+  struct GcFiber* fiber = ALLOCATE_OBJ(H, struct GcFiber, OBJ_FIBER);
+  fiber->status = FIBER_SUSPENDED;
+  fiber->function = function;
+  fiber->stack = NULL;
+  fiber->stackTop = NULL;
+  fiber->frames = NULL;
+  fiber->frameCount = 0;
+  fiber->frameCapacity = frameCapacity;
+  fiber->stackCapacity = stackCapacity;
+  fiber->openUpvalues = NULL;
+  fiber->caller = NULL;
+  fiber->nativeDepth = 0;
+  fiber->scheduled = false;
+  return fiber;
+}
+
+void allocateFiberStack(struct hs_State* H, struct GcFiber* fiber) {
+  fiber->stack = ALLOCATE(H, Value, fiber->stackCapacity);
+  fiber->stackTop = fiber->stack;
+  fiber->frames = ALLOCATE(H, struct CallFrame, fiber->frameCapacity);
+}
+
+void freeFiberStack(struct hs_State* H, struct GcFiber* fiber) {
+  if (fiber->stack == NULL) {
+    return;
+  }
+  FREE_ARRAY(H, Value, fiber->stack, fiber->stackCapacity);
+  FREE_ARRAY(H, struct CallFrame, fiber->frames, fiber->frameCapacity);
+  fiber->stack = NULL;
+  fiber->stackTop = NULL;
+  fiber->frames = NULL;
+  fiber->frameCount = 0;
+}
+
 struct GcBcFunction* newBcFunction(struct hs_State* H) {
   struct GcBcFunction* function = ALLOCATE_OBJ(H, struct GcBcFunction, OBJ_FUNCTION);
   function->arity = 0;
   function->upvalueCount = 0;
+  function->maxSlots = 0;
   function->name = NULL;
 
   function->bcCount = 0;
   function->bcCapacity = 0;
   function->bc = NULL;
-  function->lines = NULL;
+  function->lineInfo = NULL;
+  function->lineInfoCount = 0;
+  function->lineInfoCapacity = 0;
+  function->firstLine = 0;
+  function->lastLine = 0;
+  function->sharedCode = false;
   initValueArray(&function->constants);
+#ifdef DEBUG_OPCODE_STATS
+  function->executed = 0;
+#endif
 
   return function;
 }
@@ -105,8 +242,37 @@ struct GcBcFunction* newBcFunction(struct hs_State* H) {
 struct GcCFunction* newCFunction(struct hs_State* H, hs_CFunction cFunc, s32 argCount) {
   struct GcCFunction* cFunction = ALLOCATE_OBJ(
       H, struct GcCFunction, OBJ_CFUNCTION);
-  cFunction->cFunc = cFunc;
+  cFunction->kind = CFUNC_API;
+  cFunction->name = NULL;
   cFunction->arity = argCount;
+  cFunction->as.api = cFunc;
+  return cFunction;
+}
+
+struct GcCFunction* newNative(struct hs_State* H, NativeFn native, s32 arity) {
+  struct GcCFunction* cFunction = ALLOCATE_OBJ(
+      H, struct GcCFunction, OBJ_CFUNCTION);
+  cFunction->kind = CFUNC_NATIVE;
+  cFunction->name = NULL;
+  cFunction->arity = arity;
+  cFunction->as.native = native;
+  return cFunction;
+}
+
+// Exactly one of unary and binary is set.
+struct GcCFunction* newNumberNative(
+    struct hs_State* H, NumberFn1 unary, NumberFn2 binary) {
+  struct GcCFunction* cFunction = ALLOCATE_OBJ(
+      H, struct GcCFunction, OBJ_CFUNCTION);
+  cFunction->kind = CFUNC_NUMBER;
+  cFunction->name = NULL;
+  if (unary != NULL) {
+    cFunction->arity = 1;
+    cFunction->as.number1 = unary;
+  } else {
+    cFunction->arity = 2;
+    cFunction->as.number2 = binary;
+  }
   return cFunction;
 }
 
@@ -115,7 +281,8 @@ static struct GcString* allocateString(struct hs_State* H, char* chars, s32 leng
   string->length = length;
   string->chars = chars;
   string->hash = hash;
-  
+  string->release = NULL;
+
   push(H, NEW_OBJ(string));
   tableSet(H, &H->strings, string, NEW_NIL);
   pop(H);
@@ -123,9 +290,9 @@ static struct GcString* allocateString(struct hs_State* H, char* chars, s32 leng
   return string;
 }
 
-static u32 hashString(const char* key, int length) {
+u32 hashString(const char* key, s32 length) {
   u32 hash = 2166136261u;
-  for (int i = 0; i < length; i++) {
+  for (s32 i = 0; i < length; i++) {
     hash ^= (u8)key[i];
     hash *= 16777619;
   }
@@ -133,7 +300,13 @@ static u32 hashString(const char* key, int length) {
 }
 
 struct GcString* copyString(struct hs_State* H, const char* chars, s32 length) {
-  u32 hash = hashString(chars, length);
+  return copyStringHashed(H, chars, length, hashString(chars, length));
+}
+
+// For callers that already know the hash, like programs loading their
+// string constants.
+struct GcString* copyStringHashed(
+    struct hs_State* H, const char* chars, s32 length, u32 hash) {
   struct GcString* interned = tableFindString(&H->strings, chars, length, hash);
   if (interned != NULL) {
     return interned;
@@ -144,6 +317,22 @@ struct GcString* copyString(struct hs_State* H, const char* chars, s32 length) {
   return allocateString(H, ownedChars, length, hash);
 }
 
+// Wraps chars without copying them. If an equal string is already interned
+// that one is used instead, and the host gets its chars back right away.
+struct GcString* externalString(
+    struct hs_State* H, const char* chars, s32 length, u32 hash, hs_ReleaseFn release) {
+  struct GcString* interned = tableFindString(&H->strings, chars, length, hash);
+  if (interned != NULL) {
+    release(chars, length);
+    return interned;
+  }
+  // Nothing collects between here and setting release, as the new string is
+  // on the stack while it's interned.
+  struct GcString* string = allocateString(H, (char*)chars, length, hash);
+  string->release = release;
+  return string;
+}
+
 struct GcString* takeString(struct hs_State* H, char* chars, s32 length) {
   u32 hash = hashString(chars, length);
   struct GcString* interned = tableFindString(&H->strings, chars, length, hash);
@@ -154,17 +343,95 @@ struct GcString* takeString(struct hs_State* H, char* chars, s32 length) {
   return allocateString(H, chars, length, hash);
 }
 
+#define LINE_RUN_MAX UINT8_MAX
+
+static void writeLineRun(struct hs_State* H, struct GcBcFunction* function, u8 length, s8 delta) {
+  if (function->lineInfoCapacity < function->lineInfoCount + 2) {
+    s32 oldCapacity = function->lineInfoCapacity;
+    function->lineInfoCapacity = GROW_CAPACITY(oldCapacity);
+    function->lineInfo = GROW_ARRAY(
+        H, u8, function->lineInfo, oldCapacity, function->lineInfoCapacity);
+  }
+
+  function->lineInfo[function->lineInfoCount++] = length;
+  function->lineInfo[function->lineInfoCount++] = (u8)delta;
+}
+
+static void writeLine(struct hs_State* H, struct GcBcFunction* function, s32 line) {
+  if (function->lineInfoCount == 0) {
+    function->firstLine = line;
+    function->lastLine = line;
+    writeLineRun(H, function, 1, 0);
+    return;
+  }
+
+  u8* length = &function->lineInfo[function->lineInfoCount - 2];
+  if (line == function->lastLine && *length < LINE_RUN_MAX) {
+    (*length)++;
+    return;
+  }
+
+  s32 delta = line - function->lastLine;
+  for (; delta > INT8_MAX; delta -= INT8_MAX) {
+    writeLineRun(H, function, 0, INT8_MAX);
+  }
+  for (; delta < INT8_MIN; delta -= INT8_MIN) {
+    writeLineRun(H, function, 0, INT8_MIN);
+  }
+  writeLineRun(H, function, 1, (s8)delta);
+  function->lastLine = line;
+}
+
 void writeBytecode(struct hs_State* H, struct GcBcFunction* function, u8 byte, s32 line) {
   if (function->bcCapacity < function->bcCount + 1) {
     s32 oldCapacity = function->bcCapacity;
     function->bcCapacity = GROW_CAPACITY(oldCapacity);
     function->bc = GROW_ARRAY(H, u8, function->bc, oldCapacity, function->bcCapacity);
-    function->lines = GROW_ARRAY(H, s32, function->lines, oldCapacity, function->bcCapacity);
   }
 
   function->bc[function->bcCount] = byte;
-  function->lines[function->bcCount] = line;
   function->bcCount++;
+  writeLine(H, function, line);
+}
+
+// Drops the bytecode from count on, along with its lines.
+void truncateBytecode(struct GcBcFunction* function, s32 count) {
+  s32 line = function->firstLine;
+  s32 offset = 0;
+  s32 kept = 0;
+  while (kept < function->lineInfoCount && offset < count) {
+    u8* length = &function->lineInfo[kept];
+    line += (s8)function->lineInfo[kept + 1];
+    kept += 2;
+    if (offset + *length >= count) {
+      *length = (u8)(count - offset);
+    }
+    offset += *length;
+  }
+
+  function->bcCount = count;
+  function->lineInfoCount = kept;
+  function->lastLine = line;
+}
+
+s32 lineAt(struct GcBcFunction* function, s32 offset) {
+  s32 line = function->firstLine;
+  s32 end = 0;
+  for (s32 i = 0; i < function->lineInfoCount; i += 2) {
+    line += (s8)function->lineInfo[i + 1];
+    end += function->lineInfo[i];
+    if (offset < end) {
+      break;
+    }
+  }
+  return line;
+}
+
+// The line of the instruction that ends right before ip, which is the one
+// running (or calling) while a frame's ip points past it.
+s32 functionLine(struct GcBcFunction* function, const u8* ip) {
+  s32 instruction = (s32)(ip - function->bc) - 1;
+  return lineAt(function, instruction < 0 ? 0 : instruction);
 }
 
 s32 addFunctionConstant(
@@ -17,7 +17,11 @@
 #define IS_INSTANCE(value)     isObjOfType(value, OBJ_INSTANCE)
 #define IS_ENUM(value)         isObjOfType(value, OBJ_ENUM)
 #define IS_ARRAY(value)        isObjOfType(value, OBJ_ARRAY)
+#define IS_NUM_ARRAY(value)    isObjOfType(value, OBJ_NUM_ARRAY)
+#define IS_ARRAY_VIEW(value)   isObjOfType(value, OBJ_ARRAY_VIEW)
 #define IS_UPVALUE(value)      isObjOfType(value, OBJ_UPVALUE)
+#define IS_FIBER(value)        isObjOfType(value, OBJ_FIBER)
+#define IS_USERDATA(value)     isObjOfType(value, OBJ_USERDATA)
 
 #define AS_CLOSURE(value)      ((struct GcClosure*)AS_OBJ(value))
 #define AS_FUNCTION(value)     ((struct GcBcFunction*)AS_OBJ(value))
@@ -29,7 +33,12 @@
 #define AS_INSTANCE(value)     ((struct GcInstance*)AS_OBJ(value))
 #define AS_ENUM(value)         ((struct GcEnum*)AS_OBJ(value))
 #define AS_ARRAY(value)        ((struct GcArray*)AS_OBJ(value))
+#define AS_NUM_ARRAY(value)    ((struct GcNumArray*)AS_OBJ(value))
+#define AS_ARRAY_VIEW(value)   ((struct GcArrayView*)AS_OBJ(value))
+#define AS_FIBER(value)        ((struct GcFiber*)AS_OBJ(value))
+#define AS_USERDATA(value)     ((struct GcUserdata*)AS_OBJ(value))
 
+// In the same order as enum hs_ObjectType.
 enum ObjType {
   OBJ_CLOSURE,
   OBJ_UPVALUE,
@@ -41,6 +50,17 @@ enum ObjType {
   OBJ_INSTANCE,
   OBJ_ENUM,
   OBJ_ARRAY,
+  OBJ_NUM_ARRAY,
+  OBJ_ARRAY_VIEW,
+  OBJ_FIBER,
+  OBJ_USERDATA,
+};
+
+// In the same order as enum hs_NumArrayKind.
+enum NumArrayKind {
+  NUM_ARRAY_F64,
+  NUM_ARRAY_F32,
+  NUM_ARRAY_I32,
 };
 
 #ifdef NAN_BOXING
@@ -108,6 +128,10 @@ typedef struct {
 
 #endif
 
+// The most values a ValueArray can reserve room for, since capacities round
+// up to a power of two that still has to fit in an s32.
+#define VALUE_ARRAY_MAX (1 << 30)
+
 struct ValueArray {
   s32 capacity;
   s32 count;
@@ -136,12 +160,39 @@ struct GcUpvalue {
   Value* location;
   Value closed;
   struct GcUpvalue* next;
+  // While open, location points into this fiber's stack, which has to
+  // outlive the upvalue.
+  struct GcFiber* fiber;
+};
+
+// Natives built into the VM. They read their arguments straight off the
+// stack (args[0] is the receiver or the callee) and return their result, so
+// calling them doesn't need a CallFrame.
+typedef Value (*NativeFn)(struct hs_State* H, Value* args, s32 argCount);
+
+// Natives that take and return only numbers. The VM checks the argument
+// types and calls them with plain doubles.
+typedef f64 (*NumberFn1)(f64 a);
+typedef f64 (*NumberFn2)(f64 a, f64 b);
+
+enum CFunctionKind {
+  CFUNC_API,
+  CFUNC_NATIVE,
+  CFUNC_NUMBER,
 };
 
 struct GcCFunction {
   struct GcObj obj;
-  hs_CFunction cFunc;
+  enum CFunctionKind kind;
   s32 arity;
+  // The name it was registered under, if any.
+  struct GcString* name;
+  union {
+    hs_CFunction api;
+    NativeFn native;
+    NumberFn1 number1;
+    NumberFn2 number2;
+  } as;
 };
 
 struct GcClosure {
@@ -155,14 +206,31 @@ struct GcBcFunction {
   struct GcObj obj;
   u8 arity;
   u8 upvalueCount;
+  // The most stack slots it uses at once, for locals and temporaries.
+  s32 maxSlots;
 
   s32 bcCount;
   s32 bcCapacity;
   u8* bc;
-  s32* lines;
+  // The line of each byte of bc, run-length encoded as pairs of a run's
+  // length in bytes and its line's difference from the previous run's. Runs
+  // are at most 255 bytes and differences fit in an s8; larger ones are
+  // spread over empty runs. Decoded with lineAt().
+  u8* lineInfo;
+  s32 lineInfoCount;
+  s32 lineInfoCapacity;
+  s32 firstLine;
+  s32 lastLine;
+  // bc and lineInfo belong to an hs_Program shared between states, so they are
+  // never grown or freed here.
+  bool sharedCode;
 
   struct ValueArray constants;
   struct GcString* name;
+
+#ifdef DEBUG_OPCODE_STATS
+  u64 executed;
+#endif
 };
 
 struct GcString {
@@ -170,6 +238,8 @@ struct GcString {
   s32 length;
   char* chars;
   u32 hash;
+  // Set when the host owns chars, and called instead of freeing them.
+  hs_ReleaseFn release;
 };
 
 struct GcStruct {
@@ -203,6 +273,77 @@ struct GcArray {
   struct ValueArray values;
 };
 
+// A window into another array's storage. If the parent shrinks, the view
+// shrinks with it.
+struct GcArrayView {
+  struct GcObj obj;
+  struct GcArray* parent;
+  s32 start;
+  s32 length;
+};
+
+struct CallFrame {
+  struct GcClosure* func;
+  u8* ip;
+  Value* slots;
+  // When the tracer saw the call start, or 0 if it wasn't running.
+  u64 tracedAt;
+};
+
+enum FiberStatus {
+  FIBER_SUSPENDED, // Not started yet, or yielded.
+  FIBER_RUNNING,
+  FIBER_NORMAL,    // Resumed another fiber and waits for it.
+  FIBER_DONE,
+  FIBER_ERROR,
+};
+
+// A coroutine with its own value stack and call frames. The running fiber's
+// stack pointers live in the hs_State, so switching fibers only swaps them.
+struct GcFiber {
+  struct GcObj obj;
+  enum FiberStatus status;
+  struct GcClosure* function;
+
+  Value* stack;
+  Value* stackTop;
+  struct CallFrame* frames;
+  s32 frameCount;
+  s32 frameCapacity;
+  s32 stackCapacity;
+  struct GcUpvalue* openUpvalues;
+
+  // The fiber that resumed this one, while it runs.
+  struct GcFiber* caller;
+  // Native calls in progress on this fiber. It can't yield across them.
+  s32 nativeDepth;
+  // Whether the scheduler has taken it as a task, so it isn't queued twice.
+  bool scheduled;
+};
+
+// Fixed length array of unboxed numbers, so native kernels can work on the
+// buffer directly.
+struct GcNumArray {
+  struct GcObj obj;
+  enum NumArrayKind kind;
+  s32 count;
+  void* data;
+};
+
+struct UserdataClass;
+
+// Host data stored inline right after the header, so it needs no side
+// table. The class says how to trace and finalize it.
+struct GcUserdata {
+  struct GcObj obj;
+  struct UserdataClass* cls;
+  size_t size;
+  _Alignas(max_align_t) u8 data[];
+};
+
+#define USERDATA_FROM_DATA(data) \
+    ((struct GcUserdata*)((u8*)(data) - offsetof(struct GcUserdata, data)))
+
 void initValueArray(struct ValueArray* array);
 void copyValueArray(struct hs_State* H, struct ValueArray* dest, struct ValueArray* src);
 void writeValueArray(struct hs_State* H, struct ValueArray* array, Value value);
@@ -212,9 +353,21 @@ void printValue(struct hs_State* H, Value value);
 bool valuesEqual(Value a, Value b);
 
 struct GcArray* newArray(struct hs_State* H);
+struct GcArrayView* newArrayView(
+    struct hs_State* H, struct GcArray* parent, s32 start, s32 length);
+s32 arrayViewCount(struct GcArrayView* view);
+struct GcNumArray* newNumArray(struct hs_State* H, enum NumArrayKind kind, s32 count);
+size_t numArrayElementSize(enum NumArrayKind kind);
+f64 numArrayGet(struct GcNumArray* array, s32 index);
+void numArraySet(struct GcNumArray* array, s32 index, f64 value);
 struct GcEnum* newEnum(struct hs_State* H, struct GcString* name);
 struct GcString* copyString(struct hs_State* H, const char* chars, int length);
 struct GcString* takeString(struct hs_State* H, char* chars, int length);
+struct GcString* copyStringHashed(
+    struct hs_State* H, const char* chars, s32 length, u32 hash);
+struct GcString* externalString(
+    struct hs_State* H, const char* chars, s32 length, u32 hash, hs_ReleaseFn release);
+u32 hashString(const char* key, s32 length);
 struct GcStruct* newStruct(struct hs_State* H, struct GcString* name);
 struct GcInstance* newInstance(struct hs_State* H, struct GcStruct* strooct);
 
@@ -222,11 +375,23 @@ struct GcClosure* newClosure(struct hs_State* H, struct GcBcFunction* function);
 struct GcUpvalue* newUpvalue(struct hs_State* H, Value* slot);
 struct GcBcFunction* newBcFunction(struct hs_State* H);
 struct GcCFunction* newCFunction(struct hs_State* H, hs_CFunction cFunc, int argCount);
+struct GcCFunction* newNative(struct hs_State* H, NativeFn native, s32 arity);
+struct GcCFunction* newNumberNative(
+    struct hs_State* H, NumberFn1 unary, NumberFn2 binary);
+struct GcFiber* newFiber(struct hs_State* H, struct GcClosure* function,
+    s32 frameCapacity, s32 stackCapacity);
+void allocateFiberStack(struct hs_State* H, struct GcFiber* fiber);
+void freeFiberStack(struct hs_State* H, struct GcFiber* fiber);
+struct GcUserdata* newUserdata(
+    struct hs_State* H, struct UserdataClass* cls, size_t size);
 struct GcBoundMethod* newBoundMethod(
     struct hs_State* H, Value receiver, struct GcClosure* method);
 void writeBytecode(struct hs_State* H, struct GcBcFunction* function, u8 byte, s32 line);
+void truncateBytecode(struct GcBcFunction* function, s32 count);
 s32 addFunctionConstant(
     struct hs_State* H, struct GcBcFunction* function, Value value);
+s32 lineAt(struct GcBcFunction* function, s32 offset);
+s32 functionLine(struct GcBcFunction* function, const u8* ip);
 
 static inline bool isObjOfType(Value value, enum ObjType type) {
   return IS_OBJ(value) && AS_OBJ(value)->type == type;
@@ -1,27 +1,45 @@
 #ifndef _HOBBYSCRIPT_OPCODES
 #define _HOBBYSCRIPT_OPCODES
 
+// Instructions take one-byte operands, and jumps two-byte offsets. The _LONG
+// variants are only emitted when an operand doesn't fit: constant, name,
+// global and local operands grow to two bytes, jump offsets to three.
+
 enum Bytecode {
   BC_CONSTANT,
+  BC_CONSTANT_LONG,
   BC_NIL,
   BC_TRUE,
   BC_FALSE,
   BC_POP,
   BC_ARRAY,
+  BC_ARRAY_LONG,
+  BC_ARRAY_CONSTANT,
+  BC_ARRAY_CONSTANT_LONG,
   BC_GET_SUBSCRIPT,
   BC_SET_SUBSCRIPT,
   BC_DEFINE_GLOBAL,
+  BC_DEFINE_GLOBAL_LONG,
   BC_GET_GLOBAL,
+  BC_GET_GLOBAL_LONG,
   BC_SET_GLOBAL,
+  BC_SET_GLOBAL_LONG,
   BC_GET_UPVALUE,
   BC_SET_UPVALUE,
   BC_GET_LOCAL,
+  BC_GET_LOCAL_LONG,
   BC_SET_LOCAL,
+  BC_SET_LOCAL_LONG,
   BC_INIT_PROPERTY,
+  BC_INIT_PROPERTY_LONG,
   BC_GET_STATIC,
+  BC_GET_STATIC_LONG,
   BC_PUSH_PROPERTY,
+  BC_PUSH_PROPERTY_LONG,
   BC_GET_PROPERTY,
+  BC_GET_PROPERTY_LONG,
   BC_SET_PROPERTY,
+  BC_SET_PROPERTY_LONG,
   BC_DESTRUCT_ARRAY,
   BC_EQUAL,
   BC_NOT_EQUAL,
@@ -39,22 +57,44 @@ enum Bytecode {
   BC_NEGATE,
   BC_NOT,
   BC_JUMP,
+  BC_JUMP_LONG,
   BC_JUMP_IF_FALSE,
+  BC_JUMP_IF_FALSE_LONG,
   BC_INEQUALITY_JUMP,
+  BC_INEQUALITY_JUMP_LONG,
   BC_LOOP,
+  BC_LOOP_LONG,
+  BC_FOR_PREP,
+  BC_FOR_PREP_LONG,
+  BC_FOR_ITER,
+  BC_FOR_ITER_LONG,
   BC_CALL,
   BC_INSTANCE,
   BC_CLOSURE,
+  BC_CLOSURE_LONG,
   BC_CLOSE_UPVALUE,
   BC_RETURN,
   BC_ENUM,
+  BC_ENUM_LONG,
   BC_ENUM_VALUE,
+  BC_ENUM_VALUE_LONG,
   BC_STRUCT,
+  BC_STRUCT_LONG,
   BC_STRUCT_FIELD,
+  BC_STRUCT_FIELD_LONG,
   BC_METHOD,
+  BC_METHOD_LONG,
   BC_STATIC_METHOD,
+  BC_STATIC_METHOD_LONG,
   BC_INVOKE,
+  BC_INVOKE_LONG,
+  BC_YIELD,
+  BC_RESUME,
   BC_BREAK,
 };
 
+// Flags in the byte before each upvalue's index in BC_CLOSURE.
+#define UPVALUE_LOCAL 0x1
+#define UPVALUE_WIDE 0x2 // The index takes two bytes.
+
 #endif // _HOBBYSCRIPT_OPCODES
@@ -0,0 +1,334 @@
+#include "opstats.h"
+
+#ifdef DEBUG_OPCODE_STATS
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "debug.h"
+#include "opcodes.h"
+
+#if defined(DEBUG_OPCODE_CYCLES) && !(defined(__x86_64__) || defined(__i386__))
+#undef DEBUG_OPCODE_CYCLES
+#endif
+
+#ifdef DEBUG_OPCODE_CYCLES
+#include <x86intrin.h>
+#endif
+
+#define REPORT_TOP 20
+// Bucket i holds the instructions that took [2^i, 2^(i+1)) cycles.
+#define CYCLE_BUCKETS 16
+
+#ifdef DEBUG_OPCODE_CYCLES
+
+enum OpcodeClass {
+  OPCLASS_CONSTANT,
+  OPCLASS_VARIABLE,
+  OPCLASS_ARITHMETIC,
+  OPCLASS_BRANCH,
+  OPCLASS_CALL,
+  OPCLASS_OBJECT,
+  OPCLASS_COUNT,
+};
+
+static const char* classNames[] = {
+  "constant", "variable", "arithmetic", "branch", "call", "object",
+};
+
+#endif
+
+struct FunctionStats {
+  char* name;
+  s32 line;
+  u64 executed;
+};
+
+struct OpcodeStats {
+  u64 counts[U8_COUNT];
+  u64 pairs[U8_COUNT][U8_COUNT];
+  u8 previous;
+
+  struct FunctionStats* functions;
+  s32 functionCount;
+  s32 functionCapacity;
+
+#ifdef DEBUG_OPCODE_CYCLES
+  u64 lastTsc;
+  u64 cycles[OPCLASS_COUNT][CYCLE_BUCKETS];
+  u64 classTotals[OPCLASS_COUNT];
+  u64 classCounts[OPCLASS_COUNT];
+#endif
+};
+
+#ifdef DEBUG_OPCODE_CYCLES
+
+static enum OpcodeClass opcodeClass(u8 instruction) {
+  switch (instruction) {
+    case BC_CONSTANT:
+    case BC_CONSTANT_LONG:
+    case BC_NIL:
+    case BC_TRUE:
+    case BC_FALSE:
+    case BC_POP:
+      return OPCLASS_CONSTANT;
+    case BC_DEFINE_GLOBAL:
+    case BC_DEFINE_GLOBAL_LONG:
+    case BC_GET_GLOBAL:
+    case BC_GET_GLOBAL_LONG:
+    case BC_SET_GLOBAL:
+    case BC_SET_GLOBAL_LONG:
+    case BC_GET_UPVALUE:
+    case BC_SET_UPVALUE:
+    case BC_GET_LOCAL:
+    case BC_GET_LOCAL_LONG:
+    case BC_SET_LOCAL:
+    case BC_SET_LOCAL_LONG:
+      return OPCLASS_VARIABLE;
+    case BC_EQUAL:
+    case BC_NOT_EQUAL:
+    case BC_GREATER:
+    case BC_GREATER_EQUAL:
+    case BC_LESSER:
+    case BC_LESSER_EQUAL:
+    case BC_CONCAT:
+    case BC_ADD:
+    case BC_SUBTRACT:
+    case BC_MULTIPLY:
+    case BC_DIVIDE:
+    case BC_MODULO:
+    case BC_POW:
+    case BC_NEGATE:
+    case BC_NOT:
+      return OPCLASS_ARITHMETIC;
+    case BC_JUMP:
+    case BC_JUMP_LONG:
+    case BC_JUMP_IF_FALSE:
+    case BC_JUMP_IF_FALSE_LONG:
+    case BC_INEQUALITY_JUMP:
+    case BC_INEQUALITY_JUMP_LONG:
+    case BC_LOOP:
+    case BC_LOOP_LONG:
+    case BC_FOR_PREP:
+    case BC_FOR_PREP_LONG:
+    case BC_FOR_ITER:
+    case BC_FOR_ITER_LONG:
+    case BC_BREAK:
+      return OPCLASS_BRANCH;
+    case BC_CALL:
+    case BC_INVOKE:
+    case BC_INVOKE_LONG:
+    case BC_CLOSURE:
+    case BC_CLOSURE_LONG:
+    case BC_CLOSE_UPVALUE:
+    case BC_RETURN:
+    case BC_YIELD:
+    case BC_RESUME:
+      return OPCLASS_CALL;
+    default:
+      return OPCLASS_OBJECT;
+  }
+}
+
+#endif
+
+struct OpcodeStats* newOpcodeStats() {
+  struct OpcodeStats* stats = calloc(1, sizeof(struct OpcodeStats));
+#ifdef DEBUG_OPCODE_CYCLES
+  stats->lastTsc = __rdtsc();
+#endif
+  return stats;
+}
+
+void countInstruction(
+    struct OpcodeStats* stats, struct GcBcFunction* function, u8 instruction) {
+#ifdef DEBUG_OPCODE_CYCLES
+  // The time since the last dispatch belongs to the previous instruction.
+  u64 now = __rdtsc();
+  u64 elapsed = now - stats->lastTsc;
+  enum OpcodeClass previousClass = opcodeClass(stats->previous);
+  s32 bucket = 0;
+  while (bucket < CYCLE_BUCKETS - 1 && elapsed >> (bucket + 1) != 0) {
+    bucket++;
+  }
+  stats->cycles[previousClass][bucket]++;
+  stats->classTotals[previousClass] += elapsed;
+  stats->classCounts[previousClass]++;
+  stats->lastTsc = now;
+#endif
+
+  stats->counts[instruction]++;
+  stats->pairs[stats->previous][instruction]++;
+  stats->previous = instruction;
+  function->executed++;
+}
+
+static void saveFunction(struct OpcodeStats* stats, struct GcBcFunction* function) {
+  if (function->executed == 0) {
+    return;
+  }
+
+  if (stats->functionCount == stats->functionCapacity) {
+    stats->functionCapacity = stats->functionCapacity < 8 ? 8 : stats->functionCapacity * 2;
+    stats->functions = realloc(
+        stats->functions, sizeof(struct FunctionStats) * stats->functionCapacity);
+  }
+
+  const char* name = function->name != NULL ? function->name->chars : "script";
+  struct FunctionStats* saved = &stats->functions[stats->functionCount++];
+  saved->name = malloc(strlen(name) + 1);
+  strcpy(saved->name, name);
+  saved->line = function->firstLine;
+  saved->executed = function->executed;
+  function->executed = 0;
+}
+
+void saveFunctionStats(struct OpcodeStats* stats, struct GcObj* objects, bool unmarkedOnly) {
+  for (struct GcObj* object = objects; object != NULL; object = object->next) {
+    if (object->type == OBJ_FUNCTION && !(unmarkedOnly && object->isMarked)) {
+      saveFunction(stats, (struct GcBcFunction*)object);
+    }
+  }
+}
+
+struct Ranked {
+  s32 index;
+  u64 count;
+};
+
+static s32 compareRanked(const void* a, const void* b) {
+  u64 countA = ((const struct Ranked*)a)->count;
+  u64 countB = ((const struct Ranked*)b)->count;
+  return countA < countB ? 1 : countA > countB ? -1 : 0;
+}
+
+static s32 compareFunctions(const void* a, const void* b) {
+  const struct FunctionStats* functionA = a;
+  const struct FunctionStats* functionB = b;
+  s32 byName = strcmp(functionA->name, functionB->name);
+  return byName != 0 ? byName : functionA->line - functionB->line;
+}
+
+static f64 percent(u64 count, u64 total) {
+  return total == 0 ? 0 : 100.0 * (f64)count / (f64)total;
+}
+
+static void reportOpcodes(struct OpcodeStats* stats, FILE* out, u64 total) {
+  struct Ranked ranked[U8_COUNT];
+  for (s32 i = 0; i < U8_COUNT; i++) {
+    ranked[i].index = i;
+    ranked[i].count = stats->counts[i];
+  }
+  qsort(ranked, U8_COUNT, sizeof(struct Ranked), compareRanked);
+
+  fprintf(out, "== Instructions (%llu run) ==\n", (unsigned long long)total);
+  for (s32 i = 0; i < U8_COUNT && ranked[i].count > 0; i++) {
+    fprintf(out, "%-22s %12llu %6.2f%%\n", opcodeName(ranked[i].index),
+        (unsigned long long)ranked[i].count, percent(ranked[i].count, total));
+  }
+}
+
+static void reportPairs(struct OpcodeStats* stats, FILE* out, u64 total) {
+  // Keeps the top pairs in order with an insertion sort.
+  struct Ranked top[REPORT_TOP];
+  s32 topCount = 0;
+  for (s32 i = 0; i < U8_COUNT * U8_COUNT; i++) {
+    u64 count = stats->pairs[i / U8_COUNT][i % U8_COUNT];
+    if (count == 0 || (topCount == REPORT_TOP && count <= top[topCount - 1].count)) {
+      continue;
+    }
+    s32 at = topCount < REPORT_TOP ? topCount++ : REPORT_TOP - 1;
+    while (at > 0 && top[at - 1].count < count) {
+      top[at] = top[at - 1];
+      at--;
+    }
+    top[at].index = i;
+    top[at].count = count;
+  }
+
+  fprintf(out, "\n== Top instruction pairs ==\n");
+  for (s32 i = 0; i < topCount; i++) {
+    fprintf(out, "%-22s -> %-22s %12llu %6.2f%%\n",
+        opcodeName(top[i].index / U8_COUNT), opcodeName(top[i].index % U8_COUNT),
+        (unsigned long long)top[i].count, percent(top[i].count, total));
+  }
+}
+
+static void reportFunctions(struct OpcodeStats* stats, FILE* out, u64 total) {
+  // Merges the copies of a function that separate loads of a program or
+  // closures over the same code produced.
+  qsort(stats->functions, stats->functionCount,
+      sizeof(struct FunctionStats), compareFunctions);
+  s32 merged = 0;
+  for (s32 i = 0; i < stats->functionCount; i++) {
+    if (merged > 0 && compareFunctions(&stats->functions[merged - 1], &stats->functions[i]) == 0) {
+      stats->functions[merged - 1].executed += stats->functions[i].executed;
+      free(stats->functions[i].name);
+    } else {
+      stats->functions[merged++] = stats->functions[i];
+    }
+  }
+  stats->functionCount = merged;
+
+  struct Ranked* ranked = malloc(sizeof(struct Ranked) * (merged > 0 ? merged : 1));
+  for (s32 i = 0; i < merged; i++) {
+    ranked[i].index = i;
+    ranked[i].count = stats->functions[i].executed;
+  }
+  qsort(ranked, merged, sizeof(struct Ranked), compareRanked);
+
+  fprintf(out, "\n== Instructions per function ==\n");
+  for (s32 i = 0; i < merged && i < REPORT_TOP; i++) {
+    struct FunctionStats* function = &stats->functions[ranked[i].index];
+    fprintf(out, "%s:%-*d %12llu %6.2f%%\n", function->name,
+        (s32)(21 - strlen(function->name)), function->line,
+        (unsigned long long)function->executed, percent(function->executed, total));
+  }
+  free(ranked);
+}
+
+#ifdef DEBUG_OPCODE_CYCLES
+static void reportCycles(struct OpcodeStats* stats, FILE* out) {
+  fprintf(out, "\n== Cycles per instruction class (log2 histogram) ==\n");
+  for (s32 i = 0; i < OPCLASS_COUNT; i++) {
+    if (stats->classCounts[i] == 0) {
+      continue;
+    }
+    fprintf(out, "%-12s mean %8.1f |", classNames[i],
+        (f64)stats->classTotals[i] / (f64)stats->classCounts[i]);
+    for (s32 bucket = 0; bucket < CYCLE_BUCKETS; bucket++) {
+      fprintf(out, " %5.1f", percent(stats->cycles[i][bucket], stats->classCounts[i]));
+    }
+    fprintf(out, "\n");
+  }
+}
+#endif
+
+void reportOpcodeStats(struct OpcodeStats* stats, FILE* out) {
+  u64 total = 0;
+  for (s32 i = 0; i < U8_COUNT; i++) {
+    total += stats->counts[i];
+  }
+  // States that never ran anything, like the ones compiling programs.
+  if (total == 0) {
+    return;
+  }
+
+  reportOpcodes(stats, out, total);
+  reportPairs(stats, out, total);
+  reportFunctions(stats, out, total);
+#ifdef DEBUG_OPCODE_CYCLES
+  reportCycles(stats, out);
+#endif
+}
+
+void freeOpcodeStats(struct OpcodeStats* stats) {
+  for (s32 i = 0; i < stats->functionCount; i++) {
+    free(stats->functions[i].name);
+  }
+  free(stats->functions);
+  free(stats);
+}
+
+#endif // DEBUG_OPCODE_STATS
@@ -0,0 +1,36 @@
+#ifndef _HOBBYSCRIPT_OPSTATS_H
+#define _HOBBYSCRIPT_OPSTATS_H
+
+#include "common.h"
+#include "object.h"
+
+// Interpreter instrumentation for tuning the VM, built with
+// `make PROFILE=opstats`. It counts every instruction run, every pair of
+// consecutive instructions and the instructions run in each function, and
+// with DEBUG_OPCODE_CYCLES also a histogram of the cycles spent per class of
+// instruction. hs_freeState() prints the report to the state's err.
+// Without DEBUG_OPCODE_STATS all of this compiles to nothing.
+
+#ifdef DEBUG_OPCODE_STATS
+
+struct OpcodeStats;
+
+struct OpcodeStats* newOpcodeStats();
+void countInstruction(struct OpcodeStats* stats, struct GcBcFunction* function, u8 instruction);
+// Functions keep their own count, which has to be saved before they are
+// freed, while their names are still around. Saves the counts of the
+// unmarked functions in the object list, or of all of them.
+void saveFunctionStats(struct OpcodeStats* stats, struct GcObj* objects, bool unmarkedOnly);
+void reportOpcodeStats(struct OpcodeStats* stats, FILE* out);
+void freeOpcodeStats(struct OpcodeStats* stats);
+
+#define COUNT_INSTRUCTION(H, function, instruction) \
+    countInstruction((H)->opcodeStats, function, instruction)
+
+#else
+
+#define COUNT_INSTRUCTION(H, function, instruction) ((void)0)
+
+#endif // DEBUG_OPCODE_STATS
+
+#endif // _HOBBYSCRIPT_OPSTATS_H
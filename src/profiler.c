@@ -0,0 +1,243 @@
+#define _XOPEN_SOURCE 700
+
+#include "profiler.h"
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "object.h"
+#include "state.h"
+
+// A sampling profiler. SIGPROF interrupts the profiled thread every so often
+// and the handler copies the running fiber's call stack into a ring buffer,
+// without allocating or locking. The VM drains the buffer now and then,
+// turning samples into folded stacks ("outer;inner count" lines, the input
+// flamegraph tools expect) that are counted up when the profiler stops.
+
+#define PROFILE_DEPTH_MAX 64
+#define PROFILE_RING_SIZE 1024
+
+// The line is looked up from the offset of the instruction when the sample
+// is drained, outside the signal handler.
+struct ProfileFrame {
+  struct GcBcFunction* function;
+  s32 offset;
+};
+
+// Innermost frame first.
+struct ProfileSample {
+  s32 depth;
+  struct ProfileFrame frames[PROFILE_DEPTH_MAX];
+};
+
+struct Profiler {
+  struct hs_State* H;
+
+  // Single producer (the signal handler) and single consumer (the drain).
+  struct ProfileSample ring[PROFILE_RING_SIZE];
+  atomic_size_t head;
+  atomic_size_t tail;
+  atomic_size_t dropped;
+
+  char** stacks;
+  s32 stackCount;
+  s32 stackCapacity;
+};
+
+#ifndef _WIN32
+
+#include <signal.h>
+#include <sys/time.h>
+
+// Only the thread that started the profiler is sampled.
+static _Thread_local struct Profiler* sampledProfiler = NULL;
+static struct sigaction previousAction;
+
+static void takeSample(UNUSED int signal) {
+  struct Profiler* profiler = sampledProfiler;
+  if (profiler == NULL) {
+    return;
+  }
+
+  size_t head = atomic_load_explicit(&profiler->head, memory_order_relaxed);
+  size_t tail = atomic_load_explicit(&profiler->tail, memory_order_acquire);
+  if (head - tail == PROFILE_RING_SIZE) {
+    atomic_fetch_add_explicit(&profiler->dropped, 1, memory_order_relaxed);
+    return;
+  }
+
+  // The VM fills in frames before counting them, so every counted frame
+  // is complete. A native call's frame has no function and is left out.
+  struct hs_State* H = profiler->H;
+  struct ProfileSample* sample = &profiler->ring[head % PROFILE_RING_SIZE];
+  s32 depth = 0;
+  for (s32 i = H->frameCount - 1; i >= 0 && depth < PROFILE_DEPTH_MAX; i--) {
+    struct CallFrame* frame = &H->frames[i];
+    if (frame->func == NULL) {
+      continue;
+    }
+    struct GcBcFunction* function = frame->func->function;
+    sample->frames[depth].function = function;
+    sample->frames[depth].offset = (s32)(frame->ip - function->bc) - 1;
+    depth++;
+  }
+
+  // Time spent in the host outside of any script isn't interesting.
+  if (depth == 0) {
+    return;
+  }
+  sample->depth = depth;
+  atomic_store_explicit(&profiler->head, head + 1, memory_order_release);
+}
+
+static bool startTimer(struct Profiler* profiler, int hz) {
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = takeSample;
+  action.sa_flags = SA_RESTART;
+  sigemptyset(&action.sa_mask);
+  if (sigaction(SIGPROF, &action, &previousAction) != 0) {
+    return false;
+  }
+
+  sampledProfiler = profiler;
+  struct itimerval timer;
+  timer.it_interval.tv_sec = 0;
+  timer.it_interval.tv_usec = 1000000 / hz;
+  timer.it_value = timer.it_interval;
+  if (setitimer(ITIMER_PROF, &timer, NULL) != 0) {
+    sampledProfiler = NULL;
+    sigaction(SIGPROF, &previousAction, NULL);
+    return false;
+  }
+  return true;
+}
+
+static void stopTimer() {
+  struct itimerval timer;
+  memset(&timer, 0, sizeof(timer));
+  setitimer(ITIMER_PROF, &timer, NULL);
+  sigaction(SIGPROF, &previousAction, NULL);
+  sampledProfiler = NULL;
+}
+
+#else
+
+static bool startTimer(UNUSED struct Profiler* profiler, UNUSED int hz) {
+  return false;
+}
+
+static void stopTimer() {}
+
+#endif // _WIN32
+
+static void appendFrame(char* buffer, size_t* length, size_t size, struct ProfileFrame* frame) {
+  const char* name = frame->function->name != NULL
+      ? frame->function->name->chars : "script";
+  s32 written = snprintf(buffer + *length, size - *length, "%s:%d", name,
+      lineAt(frame->function, frame->offset < 0 ? 0 : frame->offset));
+  if (written > 0) {
+    *length += (size_t)written;
+    if (*length >= size) {
+      *length = size - 1;
+    }
+  }
+}
+
+void drainProfiler(struct Profiler* profiler) {
+  size_t tail = atomic_load_explicit(&profiler->tail, memory_order_relaxed);
+  size_t head = atomic_load_explicit(&profiler->head, memory_order_acquire);
+
+  for (; tail != head; tail++) {
+    struct ProfileSample* sample = &profiler->ring[tail % PROFILE_RING_SIZE];
+    char buffer[4096];
+    size_t length = 0;
+    for (s32 i = sample->depth - 1; i >= 0; i--) {
+      appendFrame(buffer, &length, sizeof(buffer), &sample->frames[i]);
+      if (i > 0 && length < sizeof(buffer) - 1) {
+        buffer[length++] = ';';
+        buffer[length] = '\0';
+      }
+    }
+
+    if (profiler->stackCount == profiler->stackCapacity) {
+      profiler->stackCapacity = profiler->stackCapacity < 64 ? 64 : profiler->stackCapacity * 2;
+      profiler->stacks = realloc(profiler->stacks, sizeof(char*) * profiler->stackCapacity);
+    }
+    char* stack = malloc(length + 1);
+    memcpy(stack, buffer, length);
+    stack[length] = '\0';
+    profiler->stacks[profiler->stackCount++] = stack;
+  }
+
+  atomic_store_explicit(&profiler->tail, tail, memory_order_release);
+}
+
+static s32 compareStacks(const void* a, const void* b) {
+  return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+// SIGPROF and its timer belong to the whole process.
+static atomic_bool profiling = false;
+
+bool hs_startProfiler(struct hs_State* H, int hz) {
+  bool expected = false;
+  if (hz <= 0 || hz > 1000000
+      || !atomic_compare_exchange_strong(&profiling, &expected, true)) {
+    return false;
+  }
+
+  struct Profiler* profiler = malloc(sizeof(struct Profiler));
+  profiler->H = H;
+  atomic_init(&profiler->head, 0);
+  atomic_init(&profiler->tail, 0);
+  atomic_init(&profiler->dropped, 0);
+  profiler->stacks = NULL;
+  profiler->stackCount = 0;
+  profiler->stackCapacity = 0;
+
+  if (!startTimer(profiler, hz)) {
+    free(profiler);
+    atomic_store(&profiling, false);
+    return false;
+  }
+  H->profiler = profiler;
+  return true;
+}
+
+void hs_stopProfiler(struct hs_State* H, FILE* out) {
+  struct Profiler* profiler = H->profiler;
+  if (profiler == NULL) {
+    return;
+  }
+  stopTimer();
+  drainProfiler(profiler);
+  H->profiler = NULL;
+  atomic_store(&profiling, false);
+
+  if (out != NULL) {
+    qsort(profiler->stacks, profiler->stackCount, sizeof(char*), compareStacks);
+    for (s32 i = 0; i < profiler->stackCount;) {
+      s32 run = i + 1;
+      while (run < profiler->stackCount
+          && strcmp(profiler->stacks[run], profiler->stacks[i]) == 0) {
+        run++;
+      }
+      fprintf(out, "%s %d\n", profiler->stacks[i], run - i);
+      i = run;
+    }
+  }
+
+  size_t dropped = atomic_load(&profiler->dropped);
+  if (dropped > 0) {
+    fprintf(H->err, "Profiler dropped %zu samples.\n", dropped);
+  }
+
+  for (s32 i = 0; i < profiler->stackCount; i++) {
+    free(profiler->stacks[i]);
+  }
+  free(profiler->stacks);
+  free(profiler);
+}
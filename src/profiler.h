@@ -0,0 +1,14 @@
+#ifndef _HOBBYSCRIPT_PROFILER_H
+#define _HOBBYSCRIPT_PROFILER_H
+
+#include "common.h"
+#include "hobbyscript.h"
+
+struct Profiler;
+
+// Moves the samples taken so far out of the signal handler's ring buffer.
+// Samples point at functions, so this has to run before a collection can
+// free them.
+void drainProfiler(struct Profiler* profiler);
+
+#endif // _HOBBYSCRIPT_PROFILER_H
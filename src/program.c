@@ -0,0 +1,298 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "compiler.h"
+#include "hobbyscript.h"
+#include "memory.h"
+#include "object.h"
+#include "state.h"
+#include "table.h"
+
+// A program is a compiled script frozen outside of any state. Bytecode and
+// line tables are shared as-is by every state that loads the program. String
+// constants live in one read-only region with their hashes precomputed, so
+// loading only has to look them up in the state's intern table: tables
+// compare keys by pointer, so every state needs its own interned copy.
+
+enum ProtoConstantKind {
+  PROTO_VALUE,
+  PROTO_STRING,
+  PROTO_FUNCTION,
+  PROTO_ARRAY,
+};
+
+struct ProtoString {
+  s32 offset;
+  s32 length;
+  u32 hash;
+};
+
+struct Prototype;
+
+struct ProtoConstant {
+  enum ProtoConstantKind kind;
+  union {
+    Value value;
+    s32 string;
+    struct Prototype* function;
+    struct {
+      s32 start;
+      s32 count;
+    } array;
+  } as;
+};
+
+struct Prototype {
+  u8 arity;
+  u8 upvalueCount;
+  s32 maxSlots;
+  s32 name;
+
+  s32 bcCount;
+  u8* bc;
+  s32 lineInfoCount;
+  u8* lineInfo;
+  s32 firstLine;
+
+  s32 constantCount;
+  struct ProtoConstant* constants;
+};
+
+struct hs_Program {
+  struct Prototype* main;
+
+  s32 functionCount;
+  s32 functionCapacity;
+  struct Prototype** functions;
+
+  s32 charCount;
+  s32 charCapacity;
+  char* chars;
+
+  s32 stringCount;
+  s32 stringCapacity;
+  struct ProtoString* strings;
+
+  // Elements of constant array literals, which are never functions.
+  s32 itemCount;
+  s32 itemCapacity;
+  struct ProtoConstant* items;
+};
+
+// Programs don't belong to a state, so they use the C heap directly.
+#define PROGRAM_RESERVE(type, array, capacity, needed) \
+  do { \
+    if ((capacity) < (needed)) { \
+      while ((capacity) < (needed)) { \
+        (capacity) = GROW_CAPACITY(capacity); \
+      } \
+      (array) = (type*)realloc((array), sizeof(type) * (capacity)); \
+    } \
+  } while (false)
+
+struct Freezer {
+  struct hs_State* H;
+  struct hs_Program* program;
+  // Maps the compiling state's strings to their index in the program.
+  struct Table stringIndices;
+};
+
+static s32 freezeString(struct Freezer* freezer, struct GcString* string) {
+  Value index;
+  if (tableGet(&freezer->stringIndices, string, &index)) {
+    return (s32)AS_NUMBER(index);
+  }
+
+  struct hs_Program* program = freezer->program;
+  PROGRAM_RESERVE(char, program->chars, program->charCapacity,
+      program->charCount + string->length + 1);
+  PROGRAM_RESERVE(struct ProtoString, program->strings, program->stringCapacity,
+      program->stringCount + 1);
+
+  struct ProtoString* frozen = &program->strings[program->stringCount];
+  frozen->offset = program->charCount;
+  frozen->length = string->length;
+  frozen->hash = string->hash;
+  memcpy(program->chars + program->charCount, string->chars, string->length + 1);
+  program->charCount += string->length + 1;
+
+  tableSet(freezer->H, &freezer->stringIndices, string, NEW_NUMBER(program->stringCount));
+  return program->stringCount++;
+}
+
+static struct ProtoConstant freezeLiteral(struct Freezer* freezer, Value value) {
+  struct ProtoConstant constant;
+  if (IS_STRING(value)) {
+    constant.kind = PROTO_STRING;
+    constant.as.string = freezeString(freezer, AS_STRING(value));
+  } else {
+    constant.kind = PROTO_VALUE;
+    constant.as.value = value;
+  }
+  return constant;
+}
+
+static struct Prototype* freezeFunction(
+    struct Freezer* freezer, struct GcBcFunction* function) {
+  struct hs_Program* program = freezer->program;
+  struct Prototype* proto = malloc(sizeof(struct Prototype));
+  PROGRAM_RESERVE(struct Prototype*, program->functions, program->functionCapacity,
+      program->functionCount + 1);
+  program->functions[program->functionCount++] = proto;
+
+  proto->arity = function->arity;
+  proto->upvalueCount = function->upvalueCount;
+  proto->maxSlots = function->maxSlots;
+  proto->name = function->name != NULL ? freezeString(freezer, function->name) : -1;
+
+  proto->bcCount = function->bcCount;
+  proto->bc = malloc(sizeof(u8) * function->bcCount);
+  memcpy(proto->bc, function->bc, sizeof(u8) * function->bcCount);
+  proto->lineInfoCount = function->lineInfoCount;
+  proto->lineInfo = malloc(sizeof(u8) * function->lineInfoCount);
+  memcpy(proto->lineInfo, function->lineInfo, sizeof(u8) * function->lineInfoCount);
+  proto->firstLine = function->firstLine;
+
+  proto->constantCount = function->constants.count;
+  proto->constants = malloc(sizeof(struct ProtoConstant) * function->constants.count);
+  for (s32 i = 0; i < function->constants.count; i++) {
+    Value value = function->constants.values[i];
+    struct ProtoConstant* constant = &proto->constants[i];
+
+    if (IS_FUNCTION(value)) {
+      constant->kind = PROTO_FUNCTION;
+      constant->as.function = freezeFunction(freezer, AS_FUNCTION(value));
+    } else if (IS_ARRAY(value)) {
+      struct ValueArray* values = &AS_ARRAY(value)->values;
+      PROGRAM_RESERVE(struct ProtoConstant, program->items, program->itemCapacity,
+          program->itemCount + values->count);
+      constant->kind = PROTO_ARRAY;
+      constant->as.array.start = program->itemCount;
+      constant->as.array.count = values->count;
+      for (s32 j = 0; j < values->count; j++) {
+        program->items[program->itemCount++] = freezeLiteral(freezer, values->values[j]);
+      }
+    } else {
+      *constant = freezeLiteral(freezer, value);
+    }
+  }
+
+  return proto;
+}
+
+struct hs_Program* hs_compileProgram(const char* source, FILE* err) {
+  struct hs_State* H = hs_newState();
+  hs_setOutput(H, H->out, err);
+
+  struct GcBcFunction* function = compile(H, H->parser, source);
+  if (function == NULL) {
+    hs_freeState(H);
+    return NULL;
+  }
+  push(H, NEW_OBJ(function));
+
+  struct hs_Program* program = calloc(1, sizeof(struct hs_Program));
+  struct Freezer freezer;
+  freezer.H = H;
+  freezer.program = program;
+  initTable(&freezer.stringIndices);
+
+  program->main = freezeFunction(&freezer, function);
+
+  freeTable(H, &freezer.stringIndices);
+  hs_freeState(H);
+  return program;
+}
+
+void hs_freeProgram(struct hs_Program* program) {
+  for (s32 i = 0; i < program->functionCount; i++) {
+    struct Prototype* proto = program->functions[i];
+    free(proto->bc);
+    free(proto->lineInfo);
+    free(proto->constants);
+    free(proto);
+  }
+  free(program->functions);
+  free(program->chars);
+  free(program->strings);
+  free(program->items);
+  free(program);
+}
+
+static struct GcString* loadString(
+    struct hs_State* H, const struct hs_Program* program, s32 index) {
+  const struct ProtoString* string = &program->strings[index];
+  return copyStringHashed(
+      H, program->chars + string->offset, string->length, string->hash);
+}
+
+static Value loadLiteral(
+    struct hs_State* H, const struct hs_Program* program,
+    const struct ProtoConstant* constant) {
+  if (constant->kind == PROTO_STRING) {
+    return NEW_OBJ(loadString(H, program, constant->as.string));
+  }
+  return constant->as.value;
+}
+
+static struct GcBcFunction* loadFunction(
+    struct hs_State* H, const struct hs_Program* program,
+    const struct Prototype* proto) {
+  struct GcBcFunction* function = newBcFunction(H);
+  push(H, NEW_OBJ(function));
+
+  function->arity = proto->arity;
+  function->upvalueCount = proto->upvalueCount;
+  function->maxSlots = proto->maxSlots;
+  function->bcCount = proto->bcCount;
+  function->bcCapacity = proto->bcCount;
+  function->bc = proto->bc;
+  function->lineInfo = proto->lineInfo;
+  function->lineInfoCount = proto->lineInfoCount;
+  function->lineInfoCapacity = proto->lineInfoCount;
+  function->firstLine = proto->firstLine;
+  function->sharedCode = true;
+  if (proto->name >= 0) {
+    function->name = loadString(H, program, proto->name);
+  }
+
+  for (s32 i = 0; i < proto->constantCount; i++) {
+    const struct ProtoConstant* constant = &proto->constants[i];
+    switch (constant->kind) {
+      case PROTO_FUNCTION: {
+        struct GcBcFunction* inner = loadFunction(H, program, constant->as.function);
+        addFunctionConstant(H, function, NEW_OBJ(inner));
+        break;
+      }
+      case PROTO_ARRAY: {
+        struct GcArray* array = newArray(H);
+        push(H, NEW_OBJ(array));
+        reserveValueArray(H, &array->values, constant->as.array.count);
+        for (s32 j = 0; j < constant->as.array.count; j++) {
+          const struct ProtoConstant* item = &program->items[constant->as.array.start + j];
+          // Fits in the reserved capacity, so a freshly interned string is
+          // stored before anything else can allocate.
+          array->values.values[array->values.count++] = loadLiteral(H, program, item);
+        }
+        addFunctionConstant(H, function, NEW_OBJ(array));
+        pop(H);
+        break;
+      }
+      default:
+        addFunctionConstant(H, function, loadLiteral(H, program, constant));
+        break;
+    }
+  }
+
+  pop(H);
+  return function;
+}
+
+void hs_loadProgram(struct hs_State* H, const struct hs_Program* program) {
+  struct GcBcFunction* function = loadFunction(H, program, program->main);
+  push(H, NEW_OBJ(function));
+  struct GcClosure* closure = newClosure(H, function);
+  pop(H);
+  push(H, NEW_OBJ(closure));
+}
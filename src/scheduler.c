@@ -0,0 +1,350 @@
+#define _POSIX_C_SOURCE 199309L
+
+#include "scheduler.h"
+
+#include <string.h>
+#include <time.h>
+
+#include "memory.h"
+#include "modules.h"
+#include "state.h"
+#include "table.h"
+#include "vm.h"
+
+#define NS_PER_SECOND 1000000000.0
+
+static u64 monotonicNs() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (u64)now.tv_sec * 1000000000u + (u64)now.tv_nsec;
+}
+
+void initScheduler(struct Scheduler* scheduler) {
+  scheduler->ready = NULL;
+  scheduler->readyHead = 0;
+  scheduler->readyCount = 0;
+  scheduler->readyCapacity = 0;
+  scheduler->sleeping = NULL;
+  scheduler->sleepingCount = 0;
+  scheduler->sleepingCapacity = 0;
+  scheduler->sleepOrder = 0;
+  initTable(&scheduler->waiting);
+  scheduler->waitingCount = 0;
+  memset(&scheduler->stats, 0, sizeof(scheduler->stats));
+}
+
+void freeScheduler(struct hs_State* H, struct Scheduler* scheduler) {
+  FREE_ARRAY(H, struct GcFiber*, scheduler->ready, scheduler->readyCapacity);
+  FREE_ARRAY(H, struct SleepingTask, scheduler->sleeping, scheduler->sleepingCapacity);
+  freeTable(H, &scheduler->waiting);
+}
+
+void markScheduler(struct hs_State* H, struct Scheduler* scheduler) {
+  if (scheduler == NULL) {
+    return;
+  }
+
+  for (s32 i = 0; i < scheduler->readyCount; i++) {
+    s32 index = (scheduler->readyHead + i) % scheduler->readyCapacity;
+    markObject(H, (struct GcObj*)scheduler->ready[index]);
+  }
+  for (s32 i = 0; i < scheduler->sleepingCount; i++) {
+    markObject(H, (struct GcObj*)scheduler->sleeping[i].fiber);
+  }
+  markTable(H, &scheduler->waiting);
+}
+
+// Growing the queues can collect garbage, so the fiber being queued is kept
+// on the stack until it's stored.
+
+static void pushReady(struct hs_State* H, struct GcFiber* fiber) {
+  struct Scheduler* scheduler = H->scheduler;
+  if (scheduler->readyCount == scheduler->readyCapacity) {
+    push(H, NEW_OBJ(fiber));
+    s32 oldCapacity = scheduler->readyCapacity;
+    s32 capacity = GROW_CAPACITY(oldCapacity);
+    struct GcFiber** ready = ALLOCATE(H, struct GcFiber*, capacity);
+    for (s32 i = 0; i < scheduler->readyCount; i++) {
+      ready[i] = scheduler->ready[(scheduler->readyHead + i) % oldCapacity];
+    }
+    FREE_ARRAY(H, struct GcFiber*, scheduler->ready, oldCapacity);
+    scheduler->ready = ready;
+    scheduler->readyHead = 0;
+    scheduler->readyCapacity = capacity;
+    pop(H);
+  }
+
+  s32 tail = (scheduler->readyHead + scheduler->readyCount) % scheduler->readyCapacity;
+  scheduler->ready[tail] = fiber;
+  scheduler->readyCount++;
+}
+
+static struct GcFiber* popReady(struct Scheduler* scheduler) {
+  struct GcFiber* fiber = scheduler->ready[scheduler->readyHead];
+  scheduler->readyHead = (scheduler->readyHead + 1) % scheduler->readyCapacity;
+  scheduler->readyCount--;
+  return fiber;
+}
+
+static bool sleepsBefore(struct SleepingTask* a, struct SleepingTask* b) {
+  return a->wakeAt < b->wakeAt || (a->wakeAt == b->wakeAt && a->order < b->order);
+}
+
+static void swapSleeping(struct SleepingTask* a, struct SleepingTask* b) {
+  struct SleepingTask temp = *a;
+  *a = *b;
+  *b = temp;
+}
+
+static void pushSleeping(struct hs_State* H, struct GcFiber* fiber, u64 wakeAt) {
+  struct Scheduler* scheduler = H->scheduler;
+  if (scheduler->sleepingCount == scheduler->sleepingCapacity) {
+    push(H, NEW_OBJ(fiber));
+    s32 oldCapacity = scheduler->sleepingCapacity;
+    scheduler->sleepingCapacity = GROW_CAPACITY(oldCapacity);
+    scheduler->sleeping = GROW_ARRAY(H, struct SleepingTask, scheduler->sleeping,
+        oldCapacity, scheduler->sleepingCapacity);
+    pop(H);
+  }
+
+  struct SleepingTask* heap = scheduler->sleeping;
+  s32 index = scheduler->sleepingCount++;
+  heap[index].wakeAt = wakeAt;
+  heap[index].order = scheduler->sleepOrder++;
+  heap[index].fiber = fiber;
+
+  while (index > 0) {
+    s32 parent = (index - 1) / 2;
+    if (!sleepsBefore(&heap[index], &heap[parent])) {
+      break;
+    }
+    swapSleeping(&heap[index], &heap[parent]);
+    index = parent;
+  }
+}
+
+static void popSleeping(struct Scheduler* scheduler) {
+  struct SleepingTask* heap = scheduler->sleeping;
+  heap[0] = heap[--scheduler->sleepingCount];
+
+  s32 index = 0;
+  while (true) {
+    s32 smallest = index;
+    s32 left = index * 2 + 1;
+    s32 right = left + 1;
+    if (left < scheduler->sleepingCount && sleepsBefore(&heap[left], &heap[smallest])) {
+      smallest = left;
+    }
+    if (right < scheduler->sleepingCount && sleepsBefore(&heap[right], &heap[smallest])) {
+      smallest = right;
+    }
+    if (smallest == index) {
+      break;
+    }
+    swapSleeping(&heap[index], &heap[smallest]);
+    index = smallest;
+  }
+}
+
+static void wakeSleepers(struct hs_State* H, u64 now) {
+  struct Scheduler* scheduler = H->scheduler;
+  while (scheduler->sleepingCount > 0 && scheduler->sleeping[0].wakeAt <= now) {
+    struct GcFiber* fiber = scheduler->sleeping[0].fiber;
+    // Still on the stack while the ready queue grows.
+    push(H, NEW_OBJ(fiber));
+    popSleeping(scheduler);
+    pushReady(H, fiber);
+    pop(H);
+  }
+}
+
+static void waitForSignal(struct hs_State* H, struct GcFiber* fiber, struct GcString* name) {
+  struct Scheduler* scheduler = H->scheduler;
+  push(H, NEW_OBJ(fiber));
+
+  Value waiters;
+  if (!tableGet(&scheduler->waiting, name, &waiters)) {
+    waiters = NEW_OBJ(newArray(H));
+    push(H, waiters);
+    tableSet(H, &scheduler->waiting, name, waiters);
+    pop(H);
+  }
+  writeValueArray(H, &AS_ARRAY(waiters)->values, NEW_OBJ(fiber));
+  scheduler->waitingCount++;
+
+  pop(H);
+}
+
+static void signalTasks(struct hs_State* H, struct GcString* name) {
+  struct Scheduler* scheduler = H->scheduler;
+  Value waiters;
+  if (!tableGet(&scheduler->waiting, name, &waiters)) {
+    return;
+  }
+
+  // The array stays in the table, and so reachable, until every fiber in it
+  // is queued.
+  struct ValueArray* fibers = &AS_ARRAY(waiters)->values;
+  for (s32 i = 0; i < fibers->count; i++) {
+    pushReady(H, AS_FIBER(fibers->values[i]));
+  }
+  scheduler->waitingCount -= fibers->count;
+  tableDelete(&scheduler->waiting, name);
+}
+
+// Sleeps too long for the clock, including infinite ones, end at its last
+// tick rather than wrapping around.
+static u64 wakeTime(u64 now, f64 seconds) {
+  f64 ns = seconds * NS_PER_SECOND;
+  if (ns >= 18446744073709551616.0) { // 2^64
+    return UINT64_MAX;
+  }
+  u64 delay = (u64)ns;
+  return delay > UINT64_MAX - now ? UINT64_MAX : now + delay;
+}
+
+// Files a task that just yielded according to what it yielded, which is on
+// top of the stack. NaN and negative sleeps don't sleep.
+static void reschedule(struct hs_State* H, struct GcFiber* fiber, u64 now) {
+  Value request = peek(H, 0);
+  if (IS_NUMBER(request) && AS_NUMBER(request) > 0) {
+    pushSleeping(H, fiber, wakeTime(now, AS_NUMBER(request)));
+  } else if (IS_STRING(request)) {
+    waitForSignal(H, fiber, AS_STRING(request));
+  } else {
+    pushReady(H, fiber);
+  }
+}
+
+void hs_schedulerTick(struct hs_State* H, uint64_t budgetNs) {
+  struct Scheduler* scheduler = H->scheduler;
+  struct hs_SchedulerStats* stats = &scheduler->stats;
+  stats->tasksRun = 0;
+  stats->tasksDeferred = 0;
+  stats->tasksFinished = 0;
+  stats->tasksFailed = 0;
+
+  u64 start = monotonicNs();
+  u64 now = start;
+  wakeSleepers(H, now);
+
+  // Only the tasks that are ready now run this tick, so a task that yields
+  // straight back waits behind the others instead of starving them. Tasks
+  // left over when the budget runs out are first in line next tick.
+  s32 runnable = scheduler->readyCount;
+  for (s32 i = 0; i < runnable; i++) {
+    if (i > 0 && now - start >= budgetNs) {
+      stats->tasksDeferred = runnable - i;
+      break;
+    }
+
+    struct GcFiber* fiber = popReady(scheduler);
+    push(H, NEW_OBJ(fiber));
+    push(H, NEW_OBJ(fiber));
+    enum hs_Status status = hs_resume(H, 0);
+    stats->tasksRun++;
+    now = monotonicNs();
+
+    switch (status) {
+      case HS_YIELD:
+        reschedule(H, fiber, now);
+        break;
+      case HS_OK:
+        stats->tasksFinished++;
+        break;
+      case HS_RUNTIME_ERROR:
+        stats->tasksFailed++;
+        fprintf(H->err, "Task failed: %s\n", AS_CSTRING(peek(H, 0)));
+        break;
+    }
+    pop(H); // Result
+    pop(H); // Fiber
+  }
+
+  stats->timeUsedNs = now - start;
+}
+
+void hs_schedulerStats(struct hs_State* H, struct hs_SchedulerStats* stats) {
+  struct Scheduler* scheduler = H->scheduler;
+  *stats = scheduler->stats;
+  stats->ready = scheduler->readyCount;
+  stats->sleeping = scheduler->sleepingCount;
+  stats->waiting = scheduler->waitingCount;
+}
+
+// Why the fiber can't become a task, or NULL if it can. A task must be
+// suspended and can only be queued once.
+static const char* spawnError(struct GcFiber* fiber) {
+  switch (fiber->status) {
+    case FIBER_SUSPENDED:
+      return fiber->scheduled ? "Cannot spawn a fiber that is already a task." : NULL;
+    case FIBER_DONE: return "Cannot spawn a finished fiber.";
+    case FIBER_ERROR: return "Cannot spawn a fiber that failed.";
+    default: return "Cannot spawn a running fiber.";
+  }
+}
+
+static void spawnFiber(struct hs_State* H, struct GcFiber* fiber) {
+  fiber->scheduled = true;
+  pushReady(H, fiber);
+}
+
+bool hs_spawn(struct hs_State* H) {
+  Value value = peek(H, 0);
+  if (IS_FIBER(value) ? spawnError(AS_FIBER(value)) != NULL : !hs_newFiber(H)) {
+    return false;
+  }
+
+  spawnFiber(H, AS_FIBER(peek(H, 0)));
+  pop(H);
+  return true;
+}
+
+void hs_signal(struct hs_State* H, const char* name) {
+  struct GcString* string = copyString(H, name, strlen(name));
+  push(H, NEW_OBJ(string));
+  signalTasks(H, string);
+  pop(H);
+}
+
+static Value scheduler_spawn(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  if (IS_FIBER(args[1])) {
+    const char* error = spawnError(AS_FIBER(args[1]));
+    if (error != NULL) {
+      runtimeError(H, "%s", error);
+      return NEW_NIL;
+    }
+    spawnFiber(H, AS_FIBER(args[1]));
+    return args[1];
+  }
+
+  if (!IS_CLOSURE(args[1]) || AS_CLOSURE(args[1])->function->arity > 1) {
+    runtimeError(H, "Can only spawn fibers and functions taking at most one argument.");
+    return NEW_NIL;
+  }
+  struct GcFiber* fiber = newFiber(H, AS_CLOSURE(args[1]), FIBER_FRAMES_START, FIBER_STACK_START);
+  spawnFiber(H, fiber);
+  return NEW_OBJ(fiber);
+}
+
+static Value scheduler_signal(struct hs_State* H, Value* args, UNUSED s32 argCount) {
+  if (!IS_STRING(args[1])) {
+    runtimeError(H, "Signal names must be strings.");
+    return NEW_NIL;
+  }
+
+  signalTasks(H, AS_STRING(args[1]));
+  return NEW_NIL;
+}
+
+static const struct NativeInfo schedulerGlobals[] = {
+  {scheduler_spawn, "spawn", 1},
+  {scheduler_signal, "signal", 1},
+  {NULL, NULL, -1},
+};
+
+void openScheduler(struct hs_State* H) {
+  H->scheduler = ALLOCATE(H, struct Scheduler, 1);
+  initScheduler(H->scheduler);
+  registerNatives(H, &H->globals, schedulerGlobals);
+}
@@ -0,0 +1,43 @@
+#ifndef _HOBBYSCRIPT_SCHEDULER_H
+#define _HOBBYSCRIPT_SCHEDULER_H
+
+#include "common.h"
+#include "hobbyscript.h"
+#include "object.h"
+
+struct SleepingTask {
+  u64 wakeAt;
+  // Breaks ties between tasks waking at the same time, so they run in the
+  // order they went to sleep.
+  u64 order;
+  struct GcFiber* fiber;
+};
+
+// Runs fibers as tasks on behalf of the host. A task yields to say when it
+// wants to run again: nil for the next tick, a number of seconds to sleep,
+// or a string naming a signal to wait for.
+struct Scheduler {
+  // Ring buffer of tasks ready to run, in the order they will run.
+  struct GcFiber** ready;
+  s32 readyHead;
+  s32 readyCount;
+  s32 readyCapacity;
+
+  // Min-heap on wake time.
+  struct SleepingTask* sleeping;
+  s32 sleepingCount;
+  s32 sleepingCapacity;
+  u64 sleepOrder;
+
+  // Signal name -> array of the fibers waiting for it.
+  struct Table waiting;
+  s32 waitingCount;
+
+  struct hs_SchedulerStats stats;
+};
+
+void initScheduler(struct Scheduler* scheduler);
+void freeScheduler(struct hs_State* H, struct Scheduler* scheduler);
+void markScheduler(struct hs_State* H, struct Scheduler* scheduler);
+
+#endif // _HOBBYSCRIPT_SCHEDULER_H
@@ -2,6 +2,7 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "hobbyscript.h"
 #include "memory.h"
@@ -10,58 +11,261 @@
 #include "table.h"
 #include "tostring.h"
 #include "modules.h"
+#include "opstats.h"
+#include "scheduler.h"
+#include "userdata.h"
+#include "vm.h"
 
 void resetStack(struct hs_State* H) {
+  // An uncaught error abandons every fiber on the way back to the main one.
+  if (H->fiber != H->mainFiber) {
+    abandonFibers(H, H->mainFiber);
+  }
   H->stackTop = H->stack;
   H->frameCount = 0;
   H->openUpvalues = NULL;
 }
 
-static Value* getValueAt(struct hs_State* H, s32 index) {
-  if (index >= 0) {
-    Value* value = H->frames[H->frameCount - 1].slots + index;
-    return (value > H->stackTop) ? NULL : value;
+static void loadFiber(struct hs_State* H, struct GcFiber* fiber) {
+  // The profiler's signal handler must never see one fiber's frame count
+  // with another's frames.
+  H->frameCount = 0;
+  atomic_signal_fence(memory_order_seq_cst);
+  H->fiber = fiber;
+  H->stack = fiber->stack;
+  H->stackTop = fiber->stackTop;
+  H->frames = fiber->frames;
+  atomic_signal_fence(memory_order_seq_cst);
+  H->frameCount = fiber->frameCount;
+  H->frameCapacity = fiber->frameCapacity;
+  H->stackCapacity = fiber->stackCapacity;
+  H->openUpvalues = fiber->openUpvalues;
+}
+
+// Saves the running fiber's registers and makes `fiber` the running one.
+// Nothing on either stack is copied.
+void switchFiber(struct hs_State* H, struct GcFiber* fiber) {
+  struct GcFiber* current = H->fiber;
+  current->stackTop = H->stackTop;
+  current->frameCount = H->frameCount;
+  current->openUpvalues = H->openUpvalues;
+  loadFiber(H, fiber);
+}
+
+// Unwinds from the running fiber through its callers to `target`, which
+// must be one of them. The fibers in between can't be resumed again.
+void abandonFibers(struct hs_State* H, struct GcFiber* target) {
+  for (struct GcFiber* fiber = H->fiber; fiber != target;) {
+    struct GcFiber* caller = fiber->caller;
+    fiber->status = FIBER_ERROR;
+    fiber->caller = NULL;
+    fiber = caller;
   }
+  switchFiber(H, target);
+  target->status = FIBER_RUNNING;
+}
 
-  Value* value = H->stackTop + index;
-  return (value > H->stackTop) ? NULL : value;
+// Grows the running fiber's frames and stack to hold at least frameCount
+// frames and slotCount values, and moves everything that points into them.
+// Returns false if that's past the limits.
+bool growStack(struct hs_State* H, s32 frameCount, s32 slotCount) {
+  if (frameCount > FRAMES_MAX || slotCount > STACK_MAX) {
+    return false;
+  }
+  struct GcFiber* fiber = H->fiber;
+
+  if (slotCount > H->stackCapacity) {
+    s32 capacity = H->stackCapacity;
+    while (capacity < slotCount) {
+      capacity *= 2;
+    }
+    if (capacity > STACK_MAX) {
+      capacity = STACK_MAX;
+    }
+
+    // Collecting garbage here still marks the old stack.
+    Value* stack = ALLOCATE(H, Value, capacity);
+    Value* old = H->stack;
+    memcpy(stack, old, sizeof(Value) * (H->stackTop - old));
+    for (s32 i = 0; i < H->frameCount; i++) {
+      H->frames[i].slots = stack + (H->frames[i].slots - old);
+    }
+    for (struct GcUpvalue* upvalue = H->openUpvalues; upvalue != NULL;
+        upvalue = upvalue->next) {
+      upvalue->location = stack + (upvalue->location - old);
+    }
+    H->stackTop = stack + (H->stackTop - old);
+    H->stack = stack;
+    FREE_ARRAY(H, Value, old, H->stackCapacity);
+    H->stackCapacity = capacity;
+    fiber->stack = stack;
+    fiber->stackCapacity = capacity;
+  }
+
+  if (frameCount > H->frameCapacity) {
+    s32 capacity = H->frameCapacity;
+    while (capacity < frameCount) {
+      capacity *= 2;
+    }
+    if (capacity > FRAMES_MAX) {
+      capacity = FRAMES_MAX;
+    }
+
+    struct CallFrame* frames = ALLOCATE(H, struct CallFrame, capacity);
+    struct CallFrame* old = H->frames;
+    s32 count = H->frameCount;
+    memcpy(frames, old, sizeof(struct CallFrame) * count);
+    // Like in loadFiber(), the profiler mustn't see the old frames' count
+    // with the new frames.
+    H->frameCount = 0;
+    atomic_signal_fence(memory_order_seq_cst);
+    H->frames = frames;
+    atomic_signal_fence(memory_order_seq_cst);
+    H->frameCount = count;
+    FREE_ARRAY(H, struct CallFrame, old, H->frameCapacity);
+    H->frameCapacity = capacity;
+    fiber->frames = frames;
+    fiber->frameCapacity = capacity;
+  }
+  return true;
 }
 
+// Indexes count up from the running C function's frame, or down from the
+// top of the stack, and can't reach past either end of the frame.
+Value* getValueAt(struct hs_State* H, s32 index) {
+  Value* base = H->frameCount > 0 ? H->frames[H->frameCount - 1].slots : H->stack;
+  Value* value = index >= 0 ? base + index : H->stackTop + index;
+  return (value < base || value >= H->stackTop) ? NULL : value;
+}
 
 struct hs_State* hs_newState() {
   struct hs_State* H = malloc(sizeof(struct hs_State));
 
+  // Everything the collector looks at has to be set up before the first
+  // allocation, since any allocation may trigger a collection.
   H->objects = NULL;
-  H->parser = ALLOCATE(H, struct Parser, 1);
+  memset(&H->gcStats, 0, sizeof(H->gcStats));
+  H->gcCallback = NULL;
+  H->gcCallbackData = NULL;
+  H->parser = NULL;
+  H->scheduler = NULL;
+  H->profiler = NULL;
+  H->allocationProfiler = NULL;
+  H->tracer = NULL;
+#ifdef DEBUG_OPCODE_STATS
+  H->opcodeStats = newOpcodeStats();
+#endif
+  H->userdataClasses = NULL;
+  H->userdataClassCount = 0;
+  H->userdataClassCapacity = 0;
+  H->fiber = NULL;
+  H->mainFiber = NULL;
+  H->stack = NULL;
+  H->frames = NULL;
+  H->frameCapacity = 0;
+  H->stackCapacity = 0;
   H->bytesAllocated = 0;
   H->nextGc = 1024 * 1024;
+  H->fuel = FUEL_CHECK_INTERVAL;
+  H->fuelLeft = -1;
+  H->memoryLimit = 0;
+  H->memoryExceeded = false;
+  atomic_init(&H->interrupted, false);
   H->grayCount = 0;
   H->grayCapacity = 0;
   H->grayStack = NULL;
+  H->protectedSlot = 0;
+  H->protectedFrame = 0;
+  H->protectedFiber = NULL;
+  H->out = stdout;
+  H->err = stderr;
   resetStack(H);
   initTable(&H->strings);
   initTable(&H->globals);
   initTable(&H->arrayMethods);
+  initTable(&H->numArrayMethods);
+  initTable(&H->fiberMethods);
+
+  H->mainFiber = newFiber(H, NULL, FRAMES_MAX, STACK_MAX);
+  H->mainFiber->status = FIBER_RUNNING;
+  allocateFiberStack(H, H->mainFiber);
+  loadFiber(H, H->mainFiber);
+
+  H->parser = ALLOCATE(H, struct Parser, 1);
+  initParser(H, H->parser);
 
   openCore(H);
   openArray(H);
+  openNumArray(H);
+  openFiber(H);
+  openScheduler(H);
 
   return H;
 }
 
 void hs_freeState(struct hs_State* H) {
+  hs_stopProfiler(H, NULL);
+  hs_stopAllocationProfiler(H, NULL, NULL);
+  hs_stopTrace(H, NULL);
   freeTable(H, &H->strings);
   freeTable(H, &H->globals);
   freeTable(H, &H->arrayMethods);
+  freeTable(H, &H->numArrayMethods);
+  freeTable(H, &H->fiberMethods);
+  freeScheduler(H, H->scheduler);
+#ifdef DEBUG_OPCODE_STATS
+  saveFunctionStats(H->opcodeStats, H->objects, false);
+#endif
   freeObjects(H);
+  // After the objects, whose finalizers are found through their class.
+  freeUserdataClasses(H);
+#ifdef DEBUG_OPCODE_STATS
+  reportOpcodeStats(H->opcodeStats, H->err);
+  freeOpcodeStats(H->opcodeStats);
+#endif
   FREE(H, struct Parser, H->parser);
+  FREE(H, struct Scheduler, H->scheduler);
 
   free(H);
 }
 
+void hs_setOutput(struct hs_State* H, FILE* out, FILE* err) {
+  H->out = out;
+  H->err = err;
+}
+
+void hs_setFuel(struct hs_State* H, long long fuel) {
+  H->fuelLeft = fuel < 0 ? -1 : fuel;
+  H->fuel = 0;
+}
+
+long long hs_getFuel(struct hs_State* H) {
+  if (H->fuelLeft < 0) {
+    return -1;
+  }
+  return H->fuelLeft + (H->fuel > 0 ? H->fuel : 0);
+}
+
+void hs_setMemoryLimit(struct hs_State* H, size_t bytes) {
+  H->memoryLimit = bytes;
+}
+
+void hs_interrupt(struct hs_State* H) {
+  atomic_store(&H->interrupted, true);
+}
+
+void hs_gcStats(struct hs_State* H, struct hs_GcStats* stats) {
+  *stats = H->gcStats;
+}
+
+void hs_setGcCallback(struct hs_State* H, hs_GcCallback callback, void* userdata) {
+  H->gcCallback = callback;
+  H->gcCallbackData = userdata;
+}
+
 void hs_push(struct hs_State* H, int index) {
-  // handle NULL deref here
-  push(H, *getValueAt(H, index));
+  Value* value = getValueAt(H, index);
+  push(H, value == NULL ? NEW_NIL : *value);
 }
 
 void hs_pop(struct hs_State* H) {
@@ -75,6 +279,94 @@ void hs_setGlobal(struct hs_State* H, const char* name) {
   pop(H); // value
 }
 
+bool hs_getGlobal(struct hs_State* H, const char* name) {
+  struct GcString* key = copyString(H, name, strlen(name));
+  Value value;
+  if (!tableGet(&H->globals, key, &value)) {
+    push(H, NEW_NIL);
+    return false;
+  }
+  push(H, value);
+  return true;
+}
+
+// Calls always produce exactly one value; trim or pad it to nresults.
+static void adjustResults(struct hs_State* H, int nresults) {
+  if (nresults == 0) {
+    pop(H);
+    return;
+  }
+  for (int i = 1; i < nresults; i++) {
+    push(H, NEW_NIL);
+  }
+}
+
+bool hs_call(struct hs_State* H, int nargs, int nresults) {
+  if (!callFromC(H, nargs)) {
+    return false;
+  }
+  adjustResults(H, nresults);
+  return true;
+}
+
+enum hs_Status hs_pcall(struct hs_State* H, int nargs, int nresults) {
+  s32 oldSlot = H->protectedSlot;
+  s32 oldFrame = H->protectedFrame;
+  struct GcFiber* oldFiber = H->protectedFiber;
+  H->protectedSlot = (s32)(H->stackTop - H->stack) - nargs - 1;
+  H->protectedFrame = H->frameCount;
+  H->protectedFiber = H->fiber;
+
+  bool ok = callFromC(H, nargs);
+
+  H->protectedSlot = oldSlot;
+  H->protectedFrame = oldFrame;
+  H->protectedFiber = oldFiber;
+
+  if (!ok) {
+    push(H, NEW_OBJ(copyString(H, H->errorMessage, strlen(H->errorMessage))));
+    return HS_RUNTIME_ERROR;
+  }
+
+  adjustResults(H, nresults);
+  return HS_OK;
+}
+
+bool hs_newFiber(struct hs_State* H) {
+  Value function = peek(H, 0);
+  if (!IS_CLOSURE(function) || AS_CLOSURE(function)->function->arity > 1) {
+    return false;
+  }
+
+  struct GcFiber* fiber = newFiber(H, AS_CLOSURE(function), FIBER_FRAMES_START, FIBER_STACK_START);
+  pop(H);
+  push(H, NEW_OBJ(fiber));
+  return true;
+}
+
+enum hs_Status hs_resume(struct hs_State* H, int nargs) {
+  s32 oldSlot = H->protectedSlot;
+  s32 oldFrame = H->protectedFrame;
+  struct GcFiber* oldFiber = H->protectedFiber;
+  H->protectedSlot = (s32)(H->stackTop - H->stack) - nargs - 1;
+  H->protectedFrame = H->frameCount;
+  H->protectedFiber = H->fiber;
+
+  Value target = peek(H, nargs);
+  bool ok = resumeFromC(H, nargs);
+
+  H->protectedSlot = oldSlot;
+  H->protectedFrame = oldFrame;
+  H->protectedFiber = oldFiber;
+
+  if (!ok) {
+    push(H, NEW_OBJ(copyString(H, H->errorMessage, strlen(H->errorMessage))));
+    return HS_RUNTIME_ERROR;
+  }
+
+  return AS_FIBER(target)->status == FIBER_DONE ? HS_OK : HS_YIELD;
+}
+
 void hs_registerGlobalFunctions(struct hs_State* H, struct hs_FuncInfo* funcs) {
   for (struct hs_FuncInfo* info = funcs; info->func != NULL; info++) {
     hs_pushCFunction(H, info->func, info->argCount);
@@ -82,6 +374,31 @@ void hs_registerGlobalFunctions(struct hs_State* H, struct hs_FuncInfo* funcs) {
   }
 }
 
+static void registerFunction(
+    struct hs_State* H, struct Table* table, const char* name, struct GcCFunction* func) {
+  push(H, NEW_OBJ(func));
+  push(H, NEW_OBJ(copyString(H, name, strlen(name))));
+  func->name = AS_STRING(peek(H, 0));
+  tableSet(H, table, AS_STRING(peek(H, 0)), peek(H, 1));
+  pop(H); // Name
+  pop(H); // Function
+}
+
+void registerNatives(
+    struct hs_State* H, struct Table* table, const struct NativeInfo* natives) {
+  for (const struct NativeInfo* info = natives; info->native != NULL; info++) {
+    registerFunction(H, table, info->name, newNative(H, info->native, info->arity));
+  }
+}
+
+void registerNumberNatives(
+    struct hs_State* H, struct Table* table, const struct NumberNativeInfo* natives) {
+  for (const struct NumberNativeInfo* info = natives; info->name != NULL; info++) {
+    registerFunction(
+        H, table, info->name, newNumberNative(H, info->unary, info->binary));
+  }
+}
+
 void hs_pushNil(struct hs_State* H) {
   push(H, NEW_NIL);
 }
@@ -94,11 +411,27 @@ void hs_pushBoolean(struct hs_State* H, bool v) {
   push(H, NEW_BOOL(v));
 }
 
+// Lengths are s32, and the terminator takes one more byte. Pushes nil in
+// place of a string that's too long.
+static bool checkStringLength(struct hs_State* H, size_t length) {
+  if (length >= INT32_MAX) {
+    push(H, NEW_NIL);
+    return false;
+  }
+  return true;
+}
+
 void hs_pushString(struct hs_State* H, const char* str, size_t length) {
-  push(H, NEW_OBJ(copyString(H, str, length)));
+  if (checkStringLength(H, length)) {
+    push(H, NEW_OBJ(copyString(H, str, length)));
+  }
 }
 
 void hs_pushOwnedString(struct hs_State* H, char* str, size_t length) {
+  if (!checkStringLength(H, length)) {
+    free(str);
+    return;
+  }
   push(H, NEW_OBJ(takeString(H, str, length)));
 }
 
@@ -106,6 +439,26 @@ void hs_pushCFunction(struct hs_State* H, hs_CFunction function, int argCount) {
   push(H, NEW_OBJ(newCFunction(H, function, argCount)));
 }
 
+void hs_pushExternalString(
+    struct hs_State* H, const char* chars, size_t length, hs_ReleaseFn release) {
+  if (!checkStringLength(H, length)) {
+    release(chars, length);
+    return;
+  }
+  push(H, NEW_OBJ(externalString(H, chars, length, hashString(chars, length), release)));
+}
+
+uint32_t hs_hashString(const char* chars, size_t length) {
+  return hashString(chars, length);
+}
+
+void hs_pushStringHashed(
+    struct hs_State* H, const char* chars, size_t length, uint32_t hash) {
+  if (checkStringLength(H, length)) {
+    push(H, NEW_OBJ(copyStringHashed(H, chars, length, hash)));
+  }
+}
+
 bool hs_isString(struct hs_State* H, int index) {
   Value* v = getValueAt(H, index);
   if (v == NULL) {
@@ -114,6 +467,22 @@ bool hs_isString(struct hs_State* H, int index) {
   return IS_STRING(*v);
 }
 
+bool hs_isNumber(struct hs_State* H, int index) {
+  Value* v = getValueAt(H, index);
+  if (v == NULL) {
+    return false;
+  }
+  return IS_NUMBER(*v);
+}
+
+bool hs_isFiber(struct hs_State* H, int index) {
+  Value* v = getValueAt(H, index);
+  if (v == NULL) {
+    return false;
+  }
+  return IS_FIBER(*v);
+}
+
 bool hs_isArray(struct hs_State* H, int index) {
   Value* v = getValueAt(H, index);
   if (v == NULL) {
@@ -122,6 +491,35 @@ bool hs_isArray(struct hs_State* H, int index) {
   return IS_ARRAY(*v);
 }
 
+double hs_toNumber(struct hs_State* H, int index) {
+  Value* v = getValueAt(H, index);
+  if (v == NULL || !IS_NUMBER(*v)) {
+    return 0;
+  }
+  return AS_NUMBER(*v);
+}
+
+bool hs_getNumber(struct hs_State* H, int index, double* number) {
+  Value* v = getValueAt(H, index);
+  if (v == NULL || !IS_NUMBER(*v)) {
+    return false;
+  }
+  *number = AS_NUMBER(*v);
+  return true;
+}
+
+bool hs_getString(struct hs_State* H, int index, const char** chars, size_t* length) {
+  Value* v = getValueAt(H, index);
+  if (v == NULL || !IS_STRING(*v)) {
+    return false;
+  }
+  *chars = AS_CSTRING(*v);
+  if (length != NULL) {
+    *length = AS_STRING(*v)->length;
+  }
+  return true;
+}
+
 const char* hs_toString(struct hs_State* H, int index, size_t* length) {
   Value* v = getValueAt(H, index);
   if (v == NULL) {
@@ -148,3 +546,95 @@ void hs_pushArray(struct hs_State* H, int index) {
   writeValueArray(H, &array->values, peek(H, 0));
   pop(H);
 }
+
+// The values the host can pop: those above the running C function, or the
+// whole stack outside of any call.
+static s32 stackDepth(struct hs_State* H) {
+  Value* base = H->frameCount > 0 ? H->frames[H->frameCount - 1].slots + 1 : H->stack;
+  return (s32)(H->stackTop - base);
+}
+
+void hs_newArray(struct hs_State* H, int count) {
+  if (count < 0 || count > stackDepth(H)) {
+    push(H, NEW_NIL);
+    return;
+  }
+
+  struct GcArray* array = newArray(H);
+  push(H, NEW_OBJ(array));
+  if (count > 0) {
+    reserveValueArray(H, &array->values, count);
+    memcpy(array->values.values, H->stackTop - count - 1, sizeof(Value) * count);
+    array->values.count = count;
+  }
+  H->stackTop -= count + 1;
+  push(H, NEW_OBJ(array));
+}
+
+void hs_pushNumbers(struct hs_State* H, const double* numbers, size_t count) {
+  if (count > VALUE_ARRAY_MAX || !reserveMemory(H, sizeof(Value) * count)) {
+    push(H, NEW_NIL);
+    return;
+  }
+
+  struct GcArray* array = newArray(H);
+  push(H, NEW_OBJ(array));
+  if (count > 0) {
+    reserveValueArray(H, &array->values, (s32)count);
+    for (size_t i = 0; i < count; i++) {
+      array->values.values[i] = NEW_NUMBER(numbers[i]);
+    }
+    array->values.count = (s32)count;
+  }
+}
+
+size_t hs_arrayLength(struct hs_State* H, int index) {
+  Value* v = getValueAt(H, index);
+  if (v == NULL || !IS_ARRAY(*v)) {
+    return 0;
+  }
+  return AS_ARRAY(*v)->values.count;
+}
+
+size_t hs_readNumbers(
+    struct hs_State* H, int index, size_t start, double* out, size_t count) {
+  Value* v = getValueAt(H, index);
+  if (v == NULL || !IS_ARRAY(*v)) {
+    return 0;
+  }
+
+  struct ValueArray* values = &AS_ARRAY(*v)->values;
+  size_t read = 0;
+  for (size_t i = start; i < (size_t)values->count && read < count; i++) {
+    if (!IS_NUMBER(values->values[i])) {
+      break;
+    }
+    out[read++] = AS_NUMBER(values->values[i]);
+  }
+  return read;
+}
+
+void* hs_pushNumArray(struct hs_State* H, enum hs_NumArrayKind kind, size_t count) {
+  if (kind < HS_F64 || kind > HS_I32 || count > INT32_MAX
+      || !reserveMemory(H, numArrayElementSize((enum NumArrayKind)kind) * count)) {
+    push(H, NEW_NIL);
+    return NULL;
+  }
+
+  struct GcNumArray* array = newNumArray(H, (enum NumArrayKind)kind, (s32)count);
+  push(H, NEW_OBJ(array));
+  return array->data;
+}
+
+void* hs_toNumArray(
+    struct hs_State* H, int index, enum hs_NumArrayKind kind, size_t* count) {
+  Value* v = getValueAt(H, index);
+  if (v == NULL || !IS_NUM_ARRAY(*v)
+      || AS_NUM_ARRAY(*v)->kind != (enum NumArrayKind)kind) {
+    return NULL;
+  }
+  if (count != NULL) {
+    *count = AS_NUM_ARRAY(*v)->count;
+  }
+  return AS_NUM_ARRAY(*v)->data;
+}
@@ -1,42 +1,101 @@
 #ifndef _HOBBYSCRIPT_STATE_H
 #define _HOBBYSCRIPT_STATE_H
 
+#include <stdatomic.h>
+#include <stdio.h>
+
 #include "object.h"
 #include "common.h"
 
+// How deep any fiber's calls and stack can get.
 #define FRAMES_MAX 64
 #define STACK_MAX (FRAMES_MAX * U8_COUNT)
-
-struct CallFrame {
-  struct GcClosure* func;
-  u8* ip;
-  Value* slots;
-};
+// Stack kept free above a script function's deepest point, for the natives
+// it calls and the values the VM pushes while running an instruction.
+#define NATIVE_SLOTS U8_COUNT
+// Fibers are meant to be cheap enough to have thousands, so they start with
+// room for a few calls and grow as they go deeper. The main fiber starts at
+// the limits, since hosts push onto it before anything is called.
+#define FIBER_FRAMES_START 4
+#define FIBER_STACK_START (2 * NATIVE_SLOTS)
+// How many backward jumps and calls run between checks of the interrupt
+// flag when there is no fuel limit.
+#define FUEL_CHECK_INTERVAL 4096
 
 struct hs_State {
-  struct CallFrame frames[FRAMES_MAX];
+  // The running fiber's stack and frames. Other fibers keep theirs in their
+  // GcFiber until they are switched to.
+  struct CallFrame* frames;
   s32 frameCount;
-
-  Value stack[STACK_MAX];
+  s32 frameCapacity;
+  Value* stack;
   Value* stackTop;
+  s32 stackCapacity;
+  struct GcUpvalue* openUpvalues;
+  struct GcFiber* fiber;
+  struct GcFiber* mainFiber;
+
   struct Table globals;
   struct Table strings;
   struct Table arrayMethods;
-  struct GcUpvalue* openUpvalues;
+  struct Table numArrayMethods;
+  struct Table fiberMethods;
 
   size_t bytesAllocated;
   size_t nextGc;
 
+  // Budgets. Backward jumps and calls count fuel down, and the VM takes a
+  // slow path when it runs out to refill it from fuelLeft (-1 when there is
+  // no limit) and to check the heap limit and the interrupt flag. Tripping
+  // either of those zeroes fuel so the check happens right away.
+  s64 fuel;
+  s64 fuelLeft;
+  size_t memoryLimit;
+  bool memoryExceeded;
+  atomic_bool interrupted;
+
   struct GcObj* objects;
 
   s32 grayCount;
   s32 grayCapacity;
   struct GcObj** grayStack;
 
+  struct hs_GcStats gcStats;
+  hs_GcCallback gcCallback;
+  void* gcCallbackData;
+
   struct Parser* parser;
+  struct Scheduler* scheduler;
+  struct Profiler* profiler;
+  struct AllocationProfiler* allocationProfiler;
+  struct Tracer* tracer;
+#ifdef DEBUG_OPCODE_STATS
+  struct OpcodeStats* opcodeStats;
+#endif
+
+  // One per userdata type seen by this state.
+  struct UserdataClass** userdataClasses;
+  s32 userdataClassCount;
+  s32 userdataClassCapacity;
+
+  // Where print() and error reports go.
+  FILE* out;
+  FILE* err;
+
+  // Where runtime errors unwind to inside hs_pcall(): the stack slot, kept as
+  // an offset since the stack may move, and frame of protectedFiber, which
+  // is NULL when no protected call is running.
+  s32 protectedSlot;
+  s32 protectedFrame;
+  struct GcFiber* protectedFiber;
+  char errorMessage[256];
 };
 
 void resetStack(struct hs_State* H);
+void switchFiber(struct hs_State* H, struct GcFiber* fiber);
+void abandonFibers(struct hs_State* H, struct GcFiber* target);
+bool growStack(struct hs_State* H, s32 frameCount, s32 slotCount);
+Value* getValueAt(struct hs_State* H, s32 index);
 
 inline void push(struct hs_State* H, Value value) {
   *H->stackTop = value;
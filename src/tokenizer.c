@@ -138,14 +138,21 @@ static enum TokenType identifierType(struct Tokenizer* tokenizer) {
       if (tokenizer->end - tokenizer->start > 1) {
         switch (*(tokenizer->start + 1)) {
           case 'a': return checkKeyword(tokenizer, 2, 3, "lse", TOKEN_FALSE);
-          case 'o': return checkKeyword(tokenizer, 2, 2, "or", TOKEN_FOR);
+          case 'o': return checkKeyword(tokenizer, 2, 1, "r", TOKEN_FOR);
           case 'u': return checkKeyword(tokenizer, 2, 2, "nc", TOKEN_FUNC);
         }
       }
       break;
     }
     case 'l': return checkKeyword(tokenizer, 1, 3, "oop", TOKEN_LOOP);
-    case 'i': return checkKeyword(tokenizer, 1, 1, "f", TOKEN_IF);
+    case 'i':
+      if (tokenizer->end - tokenizer->start > 1) {
+        switch (*(tokenizer->start + 1)) {
+          case 'f': return checkKeyword(tokenizer, 2, 0, "", TOKEN_IF);
+          case 'n': return checkKeyword(tokenizer, 2, 0, "", TOKEN_IN);
+        }
+      }
+      break;
     case 'e':
       if (tokenizer->end - tokenizer->start > 1) {
         switch (*(tokenizer->start + 1)) {
@@ -174,7 +181,16 @@ static enum TokenType identifierType(struct Tokenizer* tokenizer) {
     }
     case 't': return checkKeyword(tokenizer, 1, 3, "rue", TOKEN_TRUE);
     case 'n': return checkKeyword(tokenizer, 1, 2, "il", TOKEN_NIL);
-    case 'r': return checkKeyword(tokenizer, 1, 5, "eturn", TOKEN_RETURN);
+    case 'r': {
+      if (tokenizer->end - tokenizer->start > 2 && *(tokenizer->start + 1) == 'e') {
+        switch (*(tokenizer->start + 2)) {
+          case 't': return checkKeyword(tokenizer, 3, 3, "urn", TOKEN_RETURN);
+          case 's': return checkKeyword(tokenizer, 3, 3, "ume", TOKEN_RESUME);
+        }
+      }
+      break;
+    }
+    case 'y': return checkKeyword(tokenizer, 1, 4, "ield", TOKEN_YIELD);
   }
 
   return TOKEN_IDENTIFIER;
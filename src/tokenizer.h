@@ -28,11 +28,12 @@ enum TokenType {
 
   // Keywords
   TOKEN_VAR, // var
-  TOKEN_WHILE, TOKEN_FOR, TOKEN_LOOP, // while for loop
+  TOKEN_WHILE, TOKEN_FOR, TOKEN_IN, TOKEN_LOOP, // while for in loop
   TOKEN_CONTINUE, TOKEN_BREAK, TOKEN_RETURN, // continue break return
   TOKEN_IF, TOKEN_ELSE, TOKEN_MATCH, TOKEN_CASE, // if else match case
   TOKEN_STRUCT, TOKEN_SELF, TOKEN_FUNC, TOKEN_STATIC, // struct self func static
   TOKEN_GLOBAL, TOKEN_ENUM, // global enum
+  TOKEN_YIELD, TOKEN_RESUME, // yield resume
 
   // literals
   TOKEN_TRUE, TOKEN_FALSE, TOKEN_NIL, // true false nil
@@ -8,6 +8,7 @@
 #include "memory.h"
 #include "object.h"
 #include "state.h"
+#include "userdata.h"
 
 #define NUMBER_FORMAT "%.14g"
 
@@ -45,6 +46,18 @@ struct GcString* toString(struct hs_State* H, Value value) {
     return copyString(H, "<upvalue>", 9);
   } else if (IS_ARRAY(value)) {
     return copyString(H, "<array>", 7);
+  } else if (IS_ARRAY_VIEW(value)) {
+    return copyString(H, "<array view>", 12);
+  } else if (IS_FIBER(value)) {
+    return copyString(H, "<fiber>", 7);
+  } else if (IS_USERDATA(value)) {
+    return strFormat(H, "<@>", AS_USERDATA(value)->cls->name);
+  } else if (IS_NUM_ARRAY(value)) {
+    switch (AS_NUM_ARRAY(value)->kind) {
+      case NUM_ARRAY_F64: return copyString(H, "<f64array>", 10);
+      case NUM_ARRAY_F32: return copyString(H, "<f32array>", 10);
+      case NUM_ARRAY_I32: return copyString(H, "<i32array>", 10);
+    }
   }
 
   return copyString(H, "unknown", 7);
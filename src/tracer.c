@@ -0,0 +1,171 @@
+#define _GNU_SOURCE
+
+#include "tracer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
+#include "state.h"
+
+// Records what the VM spends its time on as Chrome trace events, which
+// chrome://tracing and Perfetto show on a timeline. Each event is a complete
+// ("X") event stamped from the monotonic clock, so a host tracing its own
+// frames from the same clock sees both in one timeline. Events go into a
+// buffer allocated up front, and the ones that don't fit are only counted.
+
+#define TRACE_NAME_MAX 48
+
+struct TraceEvent {
+  const char* category;
+  char name[TRACE_NAME_MAX];
+  u64 start;
+  u64 duration;
+};
+
+struct Tracer {
+  struct TraceEvent* events;
+  size_t count;
+  size_t capacity;
+  u64 dropped;
+  u64 minNs;
+  long pid;
+  long tid;
+};
+
+u64 traceNow() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (u64)now.tv_sec * 1000000000u + (u64)now.tv_nsec;
+}
+
+static struct TraceEvent* addEvent(
+    struct Tracer* tracer, const char* category, u64 start, u64 end) {
+  if (tracer->count == tracer->capacity) {
+    tracer->dropped++;
+    return NULL;
+  }
+
+  struct TraceEvent* event = &tracer->events[tracer->count++];
+  event->category = category;
+  event->start = start;
+  event->duration = end - start;
+  return event;
+}
+
+static void setName(struct TraceEvent* event, const char* name, size_t length) {
+  if (length >= TRACE_NAME_MAX) {
+    length = TRACE_NAME_MAX - 1;
+  }
+  memcpy(event->name, name, length);
+  event->name[length] = '\0';
+}
+
+void traceCall(struct Tracer* tracer, const char* category, struct GcString* name,
+    u64 start, u64 end) {
+  if (end - start < tracer->minNs) {
+    return;
+  }
+
+  struct TraceEvent* event = addEvent(tracer, category, start, end);
+  if (event == NULL) {
+    return;
+  }
+  if (name != NULL) {
+    setName(event, name->chars, name->length);
+  } else {
+    setName(event, category, strlen(category));
+  }
+}
+
+void traceSpan(struct Tracer* tracer, const char* category, const char* name,
+    u64 start, u64 end) {
+  struct TraceEvent* event = addEvent(tracer, category, start, end);
+  if (event != NULL) {
+    setName(event, name, strlen(name));
+  }
+}
+
+bool hs_startTrace(struct hs_State* H, size_t capacity, uint64_t minNs) {
+  if (H->tracer != NULL || capacity == 0) {
+    return false;
+  }
+
+  struct Tracer* tracer = malloc(sizeof(struct Tracer));
+  tracer->events = malloc(sizeof(struct TraceEvent) * capacity);
+  if (tracer->events == NULL) {
+    free(tracer);
+    return false;
+  }
+  tracer->count = 0;
+  tracer->capacity = capacity;
+  tracer->dropped = 0;
+  tracer->minNs = minNs;
+#ifdef _WIN32
+  tracer->pid = 0;
+#else
+  tracer->pid = (long)getpid();
+#endif
+#ifdef __linux__
+  tracer->tid = (long)syscall(SYS_gettid);
+#else
+  tracer->tid = tracer->pid;
+#endif
+
+  H->tracer = tracer;
+  return true;
+}
+
+static void writeName(FILE* out, const char* name) {
+  for (const char* c = name; *c != '\0'; c++) {
+    if (*c == '"' || *c == '\\') {
+      fprintf(out, "\\%c", *c);
+    } else if ((u8)*c < 0x20) {
+      fprintf(out, "\\u%04x", (u8)*c);
+    } else {
+      putc(*c, out);
+    }
+  }
+}
+
+// Trace timestamps are in microseconds.
+static void writeEvents(struct Tracer* tracer, FILE* out) {
+  fprintf(out, "{\"traceEvents\":[\n");
+  fprintf(out, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%ld,\"tid\":%ld,"
+      "\"args\":{\"name\":\"hobbyscript\"}}", tracer->pid, tracer->tid);
+  for (size_t i = 0; i < tracer->count; i++) {
+    struct TraceEvent* event = &tracer->events[i];
+    fprintf(out, ",\n{\"name\":\"");
+    writeName(out, event->name);
+    fprintf(out, "\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%llu.%03u,\"dur\":%llu.%03u,"
+        "\"pid\":%ld,\"tid\":%ld}",
+        event->category,
+        (unsigned long long)(event->start / 1000), (unsigned)(event->start % 1000),
+        (unsigned long long)(event->duration / 1000), (unsigned)(event->duration % 1000),
+        tracer->pid, tracer->tid);
+  }
+  fprintf(out, "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped\":\"%llu\"}}\n",
+      (unsigned long long)tracer->dropped);
+}
+
+void hs_stopTrace(struct hs_State* H, FILE* out) {
+  struct Tracer* tracer = H->tracer;
+  if (tracer == NULL) {
+    return;
+  }
+  H->tracer = NULL;
+
+  if (out != NULL) {
+    writeEvents(tracer, out);
+  }
+  free(tracer->events);
+  free(tracer);
+}
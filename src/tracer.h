@@ -0,0 +1,19 @@
+#ifndef _HOBBYSCRIPT_TRACER_H
+#define _HOBBYSCRIPT_TRACER_H
+
+#include "common.h"
+#include "hobbyscript.h"
+#include "object.h"
+
+struct Tracer;
+
+u64 traceNow();
+// Records a script or native call, unless it was shorter than the tracer's
+// threshold. name may be NULL.
+void traceCall(struct Tracer* tracer, const char* category, struct GcString* name,
+    u64 start, u64 end);
+// Records the span whatever its length.
+void traceSpan(struct Tracer* tracer, const char* category, const char* name,
+    u64 start, u64 end);
+
+#endif // _HOBBYSCRIPT_TRACER_H
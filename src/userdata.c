@@ -0,0 +1,86 @@
+#include "userdata.h"
+
+#include <string.h>
+
+#include "memory.h"
+#include "state.h"
+#include "table.h"
+
+void markUserdataClasses(struct hs_State* H) {
+  for (s32 i = 0; i < H->userdataClassCount; i++) {
+    struct UserdataClass* cls = H->userdataClasses[i];
+    markObject(H, (struct GcObj*)cls->name);
+    markTable(H, &cls->methods);
+  }
+}
+
+void freeUserdataClasses(struct hs_State* H) {
+  for (s32 i = 0; i < H->userdataClassCount; i++) {
+    freeTable(H, &H->userdataClasses[i]->methods);
+    FREE(H, struct UserdataClass, H->userdataClasses[i]);
+  }
+  FREE_ARRAY(H, struct UserdataClass*, H->userdataClasses, H->userdataClassCapacity);
+}
+
+// A state only ever sees a handful of types, so a linear search is enough.
+static struct UserdataClass* findClass(
+    struct hs_State* H, const struct hs_UserdataType* type) {
+  for (s32 i = 0; i < H->userdataClassCount; i++) {
+    if (H->userdataClasses[i]->type == type) {
+      return H->userdataClasses[i];
+    }
+  }
+
+  // The class is registered before anything is stored in it, so every
+  // allocation after that finds it through the state.
+  struct UserdataClass* cls = ALLOCATE(H, struct UserdataClass, 1);
+  cls->type = type;
+  cls->name = NULL;
+  initTable(&cls->methods);
+  if (H->userdataClassCount == H->userdataClassCapacity) {
+    s32 oldCapacity = H->userdataClassCapacity;
+    H->userdataClassCapacity = GROW_CAPACITY(oldCapacity);
+    H->userdataClasses = GROW_ARRAY(H, struct UserdataClass*, H->userdataClasses,
+        oldCapacity, H->userdataClassCapacity);
+  }
+  H->userdataClasses[H->userdataClassCount++] = cls;
+
+  cls->name = copyString(H, type->name, strlen(type->name));
+  if (type->methods != NULL) {
+    for (const struct hs_FuncInfo* info = type->methods; info->func != NULL; info++) {
+      push(H, NEW_OBJ(newCFunction(H, info->func, info->argCount)));
+      push(H, NEW_OBJ(copyString(H, info->name, strlen(info->name))));
+      AS_CFUNCTION(peek(H, 1))->name = AS_STRING(peek(H, 0));
+      tableSet(H, &cls->methods, AS_STRING(peek(H, 0)), peek(H, 1));
+      pop(H); // Name
+      pop(H); // Function
+    }
+  }
+  return cls;
+}
+
+void* hs_newUserdata(
+    struct hs_State* H, const struct hs_UserdataType* type, size_t size) {
+  struct GcUserdata* userdata = newUserdata(H, findClass(H, type), size);
+  push(H, NEW_OBJ(userdata));
+  return userdata->data;
+}
+
+void* hs_toUserdata(
+    struct hs_State* H, int index, const struct hs_UserdataType* type) {
+  Value* v = getValueAt(H, index);
+  if (v == NULL || !IS_USERDATA(*v) || AS_USERDATA(*v)->cls->type != type) {
+    return NULL;
+  }
+  return AS_USERDATA(*v)->data;
+}
+
+void hs_pushUserdata(struct hs_State* H, void* data) {
+  push(H, NEW_OBJ(USERDATA_FROM_DATA(data)));
+}
+
+void hs_markUserdata(struct hs_State* H, void* data) {
+  if (data != NULL) {
+    markObject(H, (struct GcObj*)USERDATA_FROM_DATA(data));
+  }
+}
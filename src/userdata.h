@@ -0,0 +1,19 @@
+#ifndef _HOBBYSCRIPT_USERDATA_H
+#define _HOBBYSCRIPT_USERDATA_H
+
+#include "common.h"
+#include "hobbyscript.h"
+#include "object.h"
+
+// What a state knows about a host userdata type. Created the first time the
+// state makes a userdata of that type.
+struct UserdataClass {
+  const struct hs_UserdataType* type;
+  struct GcString* name;
+  struct Table methods;
+};
+
+void markUserdataClasses(struct hs_State* H);
+void freeUserdataClasses(struct hs_State* H);
+
+#endif // _HOBBYSCRIPT_USERDATA_H
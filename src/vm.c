@@ -12,48 +12,180 @@
 #include "memory.h"
 #include "object.h"
 #include "opcodes.h"
+#include "opstats.h"
+#include "profiler.h"
 #include "table.h"
 #include "state.h"
+#include "tracer.h"
+#include "userdata.h"
 
 #include "debug.h"
 
-static void runtimeError(struct hs_State* H, const char* format, ...) {
-  for (s32 i = 0; i < H->frameCount; i++) {
-    struct CallFrame* frame = &H->frames[i];
+static enum InterpretResult run(
+    struct hs_State* H, struct GcFiber* baseFiber, s32 baseFrame);
+
+static void closeUpvalues(struct hs_State* H, Value* last);
+
+// Prints the fiber's callers first, so the trace reads from the outermost
+// call inwards.
+static void printTrace(struct hs_State* H, struct GcFiber* fiber) {
+  if (fiber->caller != NULL) {
+    printTrace(H, fiber->caller);
+  }
+
+  s32 frameCount = fiber == H->fiber ? H->frameCount : fiber->frameCount;
+  for (s32 i = 0; i < frameCount; i++) {
+    struct CallFrame* frame = &fiber->frames[i];
+    if (frame->func == NULL) { // C function
+      continue;
+    }
     struct GcBcFunction* function = frame->func->function;
-    size_t instruction = frame->ip - function->bc - 1;
-    fprintf(stderr, "[line #%d] in ", function->lines[instruction]);
+    fprintf(H->err, "[line #%d] in ", functionLine(function, frame->ip));
     if (function->name == NULL) {
-      fprintf(stderr, "script\n");
+      fprintf(H->err, "script\n");
     } else {
-      fprintf(stderr, "%s\n", function->name->chars);
+      fprintf(H->err, "%s\n", function->name->chars);
     }
   }
+}
 
+void runtimeError(struct hs_State* H, const char* format, ...) {
   va_list args;
+
+  // Inside hs_pcall() only the protected call is unwound, and the message is
+  // kept for the caller instead of being printed.
+  if (H->protectedFiber != NULL) {
+    va_start(args, format);
+    vsnprintf(H->errorMessage, sizeof(H->errorMessage), format, args);
+    va_end(args);
+
+    if (H->fiber != H->protectedFiber) {
+      abandonFibers(H, H->protectedFiber);
+    }
+    closeUpvalues(H, H->stack + H->protectedSlot);
+    H->stackTop = H->stack + H->protectedSlot;
+    H->frameCount = H->protectedFrame;
+    return;
+  }
+
+  printTrace(H, H->fiber);
+
   va_start(args, format);
-  vfprintf(stderr, format, args);
+  vfprintf(H->err, format, args);
   va_end(args);
-  fputs("\n", stderr);
+  fputs("\n", H->err);
 
   resetStack(H);
 }
 
+// The slow path of the budget check in loops and calls. Returns false after
+// reporting an error.
+static bool refuel(struct hs_State* H) {
+  if (H->profiler != NULL) {
+    drainProfiler(H->profiler);
+  }
+  if (atomic_exchange(&H->interrupted, false)) {
+    runtimeError(H, "Interrupted.");
+    return false;
+  }
+  if (H->memoryExceeded) {
+    H->memoryExceeded = false;
+    runtimeError(H, "Out of memory.");
+    return false;
+  }
+
+  if (H->fuelLeft < 0) {
+    H->fuel = FUEL_CHECK_INTERVAL;
+    return true;
+  }
+  if (H->fuelLeft == 0) {
+    runtimeError(H, "Out of fuel.");
+    return false;
+  }
+
+  H->fuel = H->fuelLeft < FUEL_CHECK_INTERVAL ? H->fuelLeft : FUEL_CHECK_INTERVAL;
+  H->fuelLeft -= H->fuel;
+  return true;
+}
+
 static bool call(struct hs_State* H, struct GcClosure* closure, s32 argCount) {
   if (argCount != closure->function->arity) {
     runtimeError(H, "Expected %d arguments, but got %d.", closure->function->arity, argCount);
     return false;
   }
 
-  if (H->frameCount == FRAMES_MAX) {
+  // Besides the most the function itself uses, there has to be room for the
+  // values the natives it calls push.
+  s32 base = (s32)(H->stackTop - H->stack) - argCount - 1;
+  s32 slotCount = base + closure->function->maxSlots + NATIVE_SLOTS;
+  if ((H->frameCount == H->frameCapacity || slotCount > H->stackCapacity)
+      && !growStack(H, H->frameCount + 1, slotCount)) {
     runtimeError(H, "Stack overflow.");
     return false;
   }
 
-  struct CallFrame* frame = &H->frames[H->frameCount++];
+  if (--H->fuel <= 0 && !refuel(H)) {
+    return false;
+  }
+
+  // The frame is filled in before it's counted, since the profiler's signal
+  // handler may walk the frames at any point.
+  struct CallFrame* frame = &H->frames[H->frameCount];
   frame->func = closure;
   frame->ip = closure->function->bc;
-  frame->slots = H->stackTop - argCount - 1;
+  frame->slots = H->stack + base;
+  frame->tracedAt = H->tracer != NULL ? traceNow() : 0;
+  atomic_signal_fence(memory_order_seq_cst);
+  H->frameCount++;
+  return true;
+}
+
+// Kept out of run(), which only checks the frame's timestamp. The tracer may
+// have been stopped during the call.
+static NOINLINE void traceReturn(struct hs_State* H, struct CallFrame* frame) {
+  if (H->tracer != NULL) {
+    traceCall(H->tracer, "script", frame->func->function->name, frame->tracedAt, traceNow());
+  }
+}
+
+static void traceNative(struct hs_State* H, struct GcCFunction* func, u64 start) {
+  if (H->tracer != NULL && start != 0) {
+    traceCall(H->tracer, "native", func->name, start, traceNow());
+  }
+}
+
+static bool callNative(struct hs_State* H, NativeFn native, s32 argCount) {
+  struct GcFiber* fiber = H->fiber;
+  s32 base = (s32)(H->stackTop - H->stack) - argCount - 1;
+  Value result = native(H, H->stack + base, argCount);
+
+  // runtimeError() resets the stack, which always drops it below args, or
+  // unwinds to another fiber. Calls back into scripts may have moved it.
+  Value* args = H->stack + base;
+  if (H->fiber != fiber || H->stackTop <= args) {
+    return false;
+  }
+
+  H->stackTop = args;
+  push(H, result);
+  return true;
+}
+
+static bool callNumberNative(
+    struct hs_State* H, struct GcCFunction* func, s32 argCount) {
+  Value* args = H->stackTop - argCount;
+  for (s32 i = 0; i < argCount; i++) {
+    if (!IS_NUMBER(args[i])) {
+      runtimeError(H, "Expected a number for argument %d.", i + 1);
+      return false;
+    }
+  }
+
+  f64 result = argCount == 1
+      ? func->as.number1(AS_NUMBER(args[0]))
+      : func->as.number2(AS_NUMBER(args[0]), AS_NUMBER(args[1]));
+  H->stackTop -= argCount + 1;
+  push(H, NEW_NUMBER(result));
   return true;
 }
 
@@ -64,13 +196,47 @@ static bool callCFunc(struct hs_State* H, struct GcCFunction* func, s32 argCount
     return false;
   }
 
-  struct CallFrame* frame = &H->frames[H->frameCount++];
+  u64 start = H->tracer != NULL ? traceNow() : 0;
+  switch (func->kind) {
+    case CFUNC_NATIVE: {
+      bool ok = callNative(H, func->as.native, argCount);
+      traceNative(H, func, start);
+      return ok;
+    }
+    case CFUNC_NUMBER: {
+      bool ok = callNumberNative(H, func, argCount);
+      traceNative(H, func, start);
+      return ok;
+    }
+    case CFUNC_API:
+      break;
+  }
+
+  if (H->frameCount == H->frameCapacity
+      && !growStack(H, H->frameCount + 1, H->stackCapacity)) {
+    runtimeError(H, "Stack overflow.");
+    return false;
+  }
+
+  struct GcFiber* fiber = H->fiber;
+  s32 frameIndex = H->frameCount;
+  struct CallFrame* frame = &H->frames[frameIndex];
   frame->func = NULL;
   frame->ip = NULL;
   frame->slots = H->stackTop - argCount - 1;
+  frame->tracedAt = 0;
+  atomic_signal_fence(memory_order_seq_cst);
+  H->frameCount++;
+
+  func->as.api(H, argCount);
+
+  // The C function raised an error, which already unwound its frame.
+  if (H->fiber != fiber || H->frameCount <= frameIndex) {
+    return false;
+  }
 
-  func->cFunc(H, argCount);
   Value v = pop(H);
+  traceNative(H, func, start);
 
   H->frameCount--;
   H->stackTop = H->frames[H->frameCount].slots;
@@ -105,7 +271,7 @@ static bool invokeFromStruct(
     struct GcStruct* strooct, struct GcString* name, s32 argCount) {
   Value method;
   if (!tableGet(&strooct->methods, name, &method)) {
-    runtimeError(H, "Undefined property '%d'.", name->chars);
+    runtimeError(H, "Undefined property '%s'.", name->chars);
     return false;
   }
 
@@ -126,7 +292,8 @@ static bool invoke(struct hs_State* H, struct GcString* name, s32 argCount) {
 
       return invokeFromStruct(H, instance->strooct, name, argCount);
     }
-    case OBJ_ARRAY: {
+    case OBJ_ARRAY:
+    case OBJ_ARRAY_VIEW: {
       Value value;
       if (tableGet(&H->arrayMethods, name, &value)) {
         H->stackTop[-argCount - 1] = receiver;
@@ -134,6 +301,37 @@ static bool invoke(struct hs_State* H, struct GcString* name, s32 argCount) {
       }
 
       runtimeError(H, "Array does not contain method '%s'.", name->chars);
+      return false;
+    }
+    case OBJ_NUM_ARRAY: {
+      Value value;
+      if (tableGet(&H->numArrayMethods, name, &value)) {
+        H->stackTop[-argCount - 1] = receiver;
+        return callValue(H, value, argCount);
+      }
+
+      runtimeError(H, "Number array does not contain method '%s'.", name->chars);
+      return false;
+    }
+    case OBJ_FIBER: {
+      Value value;
+      if (tableGet(&H->fiberMethods, name, &value)) {
+        H->stackTop[-argCount - 1] = receiver;
+        return callValue(H, value, argCount);
+      }
+
+      runtimeError(H, "Fiber does not contain method '%s'.", name->chars);
+      return false;
+    }
+    case OBJ_USERDATA: {
+      struct UserdataClass* cls = AS_USERDATA(receiver)->cls;
+      Value value;
+      if (tableGet(&cls->methods, name, &value)) {
+        return callValue(H, value, argCount);
+      }
+
+      runtimeError(H, "%s does not contain method '%s'.", cls->name->chars, name->chars);
+      return false;
     }
     default:
       break;
@@ -143,6 +341,135 @@ static bool invoke(struct hs_State* H, struct GcString* name, s32 argCount) {
   return false;
 }
 
+// Builds an array from the values in [from, to). When `to` is NULL the
+// values are the top of the stack, and they are replaced by the array.
+static void buildArray(struct hs_State* H, Value* from, Value* to) {
+  bool onStack = to == NULL;
+  s32 count = (s32)((onStack ? H->stackTop : to) - from);
+
+  struct GcArray* array = newArray(H);
+  push(H, NEW_OBJ(array));
+  if (count > 0) {
+    reserveValueArray(H, &array->values, count);
+    memcpy(array->values.values, from, sizeof(Value) * count);
+    array->values.count = count;
+  }
+  pop(H);
+
+  if (onStack) {
+    H->stackTop -= count;
+  }
+  push(H, NEW_OBJ(array));
+}
+
+// Resolves a subscript on an array or an array view to the slot in the
+// backing storage. Returns NULL after reporting an error.
+static Value* arraySlot(struct hs_State* H, Value target, s32 index) {
+  struct GcArray* array;
+  s32 start = 0;
+  s32 count;
+  if (IS_ARRAY(target)) {
+    array = AS_ARRAY(target);
+    count = array->values.count;
+  } else if (IS_ARRAY_VIEW(target)) {
+    struct GcArrayView* view = AS_ARRAY_VIEW(target);
+    array = view->parent;
+    start = view->start;
+    count = arrayViewCount(view);
+  } else {
+    runtimeError(H, "Invalid target for subscript operator.");
+    return NULL;
+  }
+
+  if (index < 0 || index >= count) {
+    runtimeError(H, "Index out of bounds. Array size is %d, but tried accessing %d",
+        count, index);
+    return NULL;
+  }
+
+  return &array->values.values[start + index];
+}
+
+// Switches to the fiber below the top `valueCount` values and hands it the
+// value, or nil: as the argument of its function when it starts, or as the
+// result of the yield it suspended at. Both stay on the caller's stack until
+// the fiber's own stack is allocated, since that can collect garbage.
+static bool resumeFiber(struct hs_State* H, s32 valueCount) {
+  Value target = peek(H, valueCount);
+  if (!IS_FIBER(target)) {
+    runtimeError(H, "Can only resume fibers.");
+    return false;
+  }
+
+  struct GcFiber* fiber = AS_FIBER(target);
+  switch (fiber->status) {
+    case FIBER_SUSPENDED:
+      break;
+    case FIBER_DONE:
+      runtimeError(H, "Cannot resume a finished fiber.");
+      return false;
+    case FIBER_ERROR:
+      runtimeError(H, "Cannot resume a fiber that failed.");
+      return false;
+    default:
+      runtimeError(H, "Cannot resume a running fiber.");
+      return false;
+  }
+
+  if (fiber->stack == NULL) {
+    allocateFiberStack(H, fiber);
+  }
+  Value value = valueCount == 1 ? pop(H) : NEW_NIL;
+  pop(H); // Fiber
+  fiber->caller = H->fiber;
+  H->fiber->status = FIBER_NORMAL;
+  switchFiber(H, fiber);
+  fiber->status = FIBER_RUNNING;
+
+  if (fiber->frameCount > 0) {
+    push(H, value);
+    return true;
+  }
+
+  s32 argCount = fiber->function->function->arity;
+  push(H, NEW_OBJ(fiber->function));
+  if (argCount == 1) {
+    push(H, value);
+  }
+  return call(H, fiber->function, argCount);
+}
+
+// Suspends or finishes the running fiber, and passes `value` back to the
+// fiber that resumed it.
+static void returnToCaller(struct hs_State* H, enum FiberStatus status, Value value) {
+  struct GcFiber* fiber = H->fiber;
+  struct GcFiber* caller = fiber->caller;
+  fiber->status = status;
+  fiber->caller = NULL;
+  switchFiber(H, caller);
+  caller->status = FIBER_RUNNING;
+  // A finished fiber has returned from every frame and closed its upvalues,
+  // so nothing points into its stack any more.
+  if (status == FIBER_DONE) {
+    freeFiberStack(H, fiber);
+  }
+  push(H, value);
+}
+
+static bool yieldFiber(struct hs_State* H, Value value) {
+  if (H->fiber->caller == NULL) {
+    runtimeError(H, "Cannot yield from the main fiber.");
+    return false;
+  }
+  if (H->fiber->nativeDepth > 0) {
+    runtimeError(H, "Cannot yield across a native call.");
+    return false;
+  }
+
+  returnToCaller(H, FIBER_SUSPENDED, value);
+  return true;
+}
+
 static bool bindMethod(struct hs_State* H, struct GcStruct* strooct, struct GcString* name) {
   Value method;
   if (!tableGet(&strooct->methods, name, &method)) {
@@ -185,6 +512,7 @@ static void closeUpvalues(struct hs_State* H, Value* last) {
     struct GcUpvalue* upvalue = H->openUpvalues;
     upvalue->closed = *upvalue->location;
     upvalue->location = &upvalue->closed;
+    upvalue->fiber = NULL;
     H->openUpvalues = upvalue->next;
   }
 }
@@ -298,11 +626,50 @@ static void concatenate(struct hs_State* H) {
   push(H, NEW_OBJ(result));
 }
 
-static enum InterpretResult run(struct hs_State* H) {
+static bool getGlobal(struct hs_State* H, struct GcString* name) {
+  Value value;
+  if (!tableGet(&H->globals, name, &value)) {
+    runtimeError(H, "Undefined variable '%s'.", name->chars);
+    return false;
+  }
+  push(H, value);
+  return true;
+}
+
+static bool setGlobal(struct hs_State* H, struct GcString* name) {
+  if (tableSet(H, &H->globals, name, peek(H, 0))) {
+    tableDelete(&H->globals, name);
+    runtimeError(H, "Undefined variable '%s'.", name->chars);
+    return false;
+  }
+  return true;
+}
+
+static bool defineGlobal(struct hs_State* H, struct GcString* name) {
+  if (!tableSet(H, &H->globals, name, peek(H, 0))) {
+    tableDelete(&H->globals, name);
+    runtimeError(H, "Redefinition of '%s'.", name->chars);
+    return false;
+  }
+  pop(H);
+  return true;
+}
+
+// Runs until the frame count of baseFiber drops back to baseFrame.
+static enum InterpretResult run(
+    struct hs_State* H, struct GcFiber* baseFiber, s32 baseFrame) {
 #define READ_BYTE() (*frame->ip++)
 #define READ_SHORT() (frame->ip += 2, (u16)((frame->ip[-2] << 8) | frame->ip[-1]))
 #define READ_CONSTANT() (frame->func->function->constants.values[READ_BYTE()])
 #define READ_STRING() AS_STRING(READ_CONSTANT())
+#define READ_LONG() (frame->ip += 3, \
+    (u32)((frame->ip[-3] << 16) | (frame->ip[-2] << 8) | frame->ip[-1]))
+#define READ_CONSTANT_LONG() (frame->func->function->constants.values[READ_SHORT()])
+#define READ_STRING_LONG() AS_STRING(READ_CONSTANT_LONG())
+// The name operand of an instruction that shares its case with its _LONG
+// variant.
+#define READ_NAME(shortInstruction) \
+    (instruction == shortInstruction ? READ_STRING() : READ_STRING_LONG())
 #define BINARY_OP(outType, op) \
     do { \
       if (!IS_NUMBER(peek(H, 0)) || !IS_NUMBER(peek(H, 1))) { \
@@ -328,6 +695,7 @@ static enum InterpretResult run(struct hs_State* H) {
     disassembleInstruction(
         H, frame->func->function, (s32)(frame->ip - frame->func->function->bc));
 #endif
+    COUNT_INSTRUCTION(H, frame->func->function, *frame->ip);
     u8 instruction;
     switch (instruction = READ_BYTE()) {
       case BC_CONSTANT: {
@@ -335,20 +703,31 @@ static enum InterpretResult run(struct hs_State* H) {
         push(H, constant);
         break;
       }
+      case BC_CONSTANT_LONG: {
+        Value constant = READ_CONSTANT_LONG();
+        push(H, constant);
+        break;
+      }
       case BC_NIL:   push(H, NEW_NIL); break;
       case BC_TRUE:  push(H, NEW_BOOL(true)); break;
       case BC_FALSE: push(H, NEW_BOOL(false)); break;
       case BC_POP: pop(H); break;
       case BC_ARRAY: {
-        u8 elementCount = READ_BYTE();
-        struct GcArray* array = newArray(H);
-        push(H, NEW_OBJ(array));
-        reserveValueArray(H, &array->values, elementCount);
-        for (u8 i = 1; i <= elementCount; i++) {
-          writeValueArray(H, &array->values, peek(H, elementCount - i + 1));
-        }
-        H->stackTop -= elementCount + 1;
-        push(H, NEW_OBJ(array));
+        buildArray(H, H->stackTop - READ_BYTE(), NULL);
+        break;
+      }
+      case BC_ARRAY_LONG: {
+        buildArray(H, H->stackTop - READ_SHORT(), NULL);
+        break;
+      }
+      case BC_ARRAY_CONSTANT: {
+        struct ValueArray* literals = &AS_ARRAY(READ_CONSTANT())->values;
+        buildArray(H, literals->values, literals->values + literals->count);
+        break;
+      }
+      case BC_ARRAY_CONSTANT_LONG: {
+        struct ValueArray* literals = &AS_ARRAY(READ_CONSTANT_LONG())->values;
+        buildArray(H, literals->values, literals->values + literals->count);
         break;
       }
       case BC_GET_SUBSCRIPT: {
@@ -358,22 +737,29 @@ static enum InterpretResult run(struct hs_State* H) {
         }
         s32 index = AS_NUMBER(peek(H, 0));
 
-        if (!IS_ARRAY(peek(H, 1))) {
-          runtimeError(H, "Invalid target for subscript operator.");
-          return RUNTIME_ERR;
-        }
+        if (IS_NUM_ARRAY(peek(H, 1))) {
+          struct GcNumArray* array = AS_NUM_ARRAY(peek(H, 1));
+          if (index < 0 || index >= array->count) {
+            runtimeError(H, "Index out of bounds. Array size is %d, but tried accessing %d",
+                array->count, index);
+            return RUNTIME_ERR;
+          }
 
-        struct GcArray* array = AS_ARRAY(peek(H, 1));
+          pop(H); // Index
+          pop(H); // Array
+          push(H, NEW_NUMBER(numArrayGet(array, index)));
+          break;
+        }
 
-        if (index < 0 || index > array->values.count) {
-          runtimeError(H, "Index out of bounds. Array size is %d, but tried accessing %d",
-              array->values.count, index);
+        Value* slot = arraySlot(H, peek(H, 1), index);
+        if (slot == NULL) {
           return RUNTIME_ERR;
         }
 
+        Value value = *slot;
         pop(H); // Index
         pop(H); // Array
-        push(H, array->values.values[index]);
+        push(H, value);
         break;
       }
       case BC_SET_SUBSCRIPT: {
@@ -383,52 +769,72 @@ static enum InterpretResult run(struct hs_State* H) {
         }
         s32 index = AS_NUMBER(peek(H, 1));
 
-        if (!IS_ARRAY(peek(H, 2))) {
-          runtimeError(H, "Invalid target for subscript operator.");
-          return RUNTIME_ERR;
-        }
+        if (IS_NUM_ARRAY(peek(H, 2))) {
+          struct GcNumArray* array = AS_NUM_ARRAY(peek(H, 2));
+          if (index < 0 || index >= array->count) {
+            runtimeError(H, "Index out of bounds. Array size is %d, but tried accessing %d",
+                array->count, index);
+            return RUNTIME_ERR;
+          }
+          if (!IS_NUMBER(peek(H, 0))) {
+            runtimeError(H, "Can only store numbers in a number array.");
+            return RUNTIME_ERR;
+          }
 
-        struct GcArray* array = AS_ARRAY(peek(H, 2));
+          numArraySet(array, index, AS_NUMBER(peek(H, 0)));
+          Value value = pop(H);
+          pop(H); // Index
+          pop(H); // Array
+          push(H, value);
+          break;
+        }
 
-        if (index < 0 || index > array->values.count) {
-          runtimeError(H, "Index out of bounds. Array size is %d, but tried accessing %d",
-              array->values.count, index);
+        Value* slot = arraySlot(H, peek(H, 2), index);
+        if (slot == NULL) {
           return RUNTIME_ERR;
         }
 
-        array->values.values[index] = pop(H);
+        *slot = pop(H);
+        Value value = *slot;
         pop(H); // Index
         pop(H); // Array
-        push(H, array->values.values[index]);
+        push(H, value);
         break;
       }
       case BC_GET_GLOBAL: {
-        struct GcString* name = READ_STRING();
-        Value value;
-        if (!tableGet(&H->globals, name, &value)) {
-          runtimeError(H, "Undefined variable '%s'.", name->chars);
+        if (!getGlobal(H, READ_STRING())) {
+          return RUNTIME_ERR;
+        }
+        break;
+      }
+      case BC_GET_GLOBAL_LONG: {
+        if (!getGlobal(H, READ_STRING_LONG())) {
           return RUNTIME_ERR;
         }
-        push(H, value);
         break;
       }
       case BC_SET_GLOBAL: {
-        struct GcString* name = READ_STRING();
-        if (tableSet(H, &H->globals, name, peek(H, 0))) {
-          tableDelete(&H->globals, name);
-          runtimeError(H, "Undefined variable '%s'.", name->chars);
+        if (!setGlobal(H, READ_STRING())) {
+          return RUNTIME_ERR;
+        }
+        break;
+      }
+      case BC_SET_GLOBAL_LONG: {
+        if (!setGlobal(H, READ_STRING_LONG())) {
           return RUNTIME_ERR;
         }
         break;
       }
       case BC_DEFINE_GLOBAL: {
-        struct GcString* name = READ_STRING();
-        if (!tableSet(H, &H->globals, name, peek(H, 0))) {
-          tableDelete(&H->globals, name);
-          runtimeError(H, "Redefinition of '%s'.", name->chars);
+        if (!defineGlobal(H, READ_STRING())) {
+          return RUNTIME_ERR;
+        }
+        break;
+      }
+      case BC_DEFINE_GLOBAL_LONG: {
+        if (!defineGlobal(H, READ_STRING_LONG())) {
           return RUNTIME_ERR;
         }
-        pop(H);
         break;
       }
       case BC_GET_UPVALUE: {
@@ -451,30 +857,49 @@ static enum InterpretResult run(struct hs_State* H) {
         frame->slots[slot] = peek(H, 0);
         break;
       }
-      case BC_INIT_PROPERTY: {
-        if (!setProperty(H, READ_STRING())) {
+      case BC_GET_LOCAL_LONG: {
+        u16 slot = READ_SHORT();
+        push(H, frame->slots[slot]);
+        break;
+      }
+      case BC_SET_LOCAL_LONG: {
+        u16 slot = READ_SHORT();
+        frame->slots[slot] = peek(H, 0);
+        break;
+      }
+      case BC_INIT_PROPERTY:
+      case BC_INIT_PROPERTY_LONG: {
+        if (!setProperty(H, READ_NAME(BC_INIT_PROPERTY))) {
           return RUNTIME_ERR;
         }
 
         pop(H); // Value
         break;
       }
-      case BC_GET_STATIC: {
-        if (!getStatic(H, peek(H, 0), READ_STRING())) {
+      case BC_GET_STATIC:
+      case BC_GET_STATIC_LONG: {
+        if (!getStatic(H, peek(H, 0), READ_NAME(BC_GET_STATIC))) {
           return RUNTIME_ERR;
         }
         break;
       }
       case BC_PUSH_PROPERTY:
-      case BC_GET_PROPERTY: {
-        if (!getProperty(
-            H, peek(H, 0), READ_STRING(), instruction == BC_GET_PROPERTY)) {
+      case BC_PUSH_PROPERTY_LONG: {
+        if (!getProperty(H, peek(H, 0), READ_NAME(BC_PUSH_PROPERTY), false)) {
           return RUNTIME_ERR;
         }
         break;
       }
-      case BC_SET_PROPERTY: {
-        if (!setProperty(H, READ_STRING())) {
+      case BC_GET_PROPERTY:
+      case BC_GET_PROPERTY_LONG: {
+        if (!getProperty(H, peek(H, 0), READ_NAME(BC_GET_PROPERTY), true)) {
+          return RUNTIME_ERR;
+        }
+        break;
+      }
+      case BC_SET_PROPERTY:
+      case BC_SET_PROPERTY_LONG: {
+        if (!setProperty(H, READ_NAME(BC_SET_PROPERTY))) {
           return RUNTIME_ERR;
         }
 
@@ -561,6 +986,11 @@ static enum InterpretResult run(struct hs_State* H) {
         frame->ip += offset;
         break;
       }
+      case BC_JUMP_LONG: {
+        u32 offset = READ_LONG();
+        frame->ip += offset;
+        break;
+      }
       case BC_JUMP_IF_FALSE: {
         u16 offset = READ_SHORT();
         if (isFalsey(peek(H, 0))) {
@@ -568,6 +998,13 @@ static enum InterpretResult run(struct hs_State* H) {
         }
         break;
       }
+      case BC_JUMP_IF_FALSE_LONG: {
+        u32 offset = READ_LONG();
+        if (isFalsey(peek(H, 0))) {
+          frame->ip += offset;
+        }
+        break;
+      }
       case BC_INEQUALITY_JUMP: {
         u16 offset = READ_SHORT();
         Value b = pop(H);
@@ -577,11 +1014,112 @@ static enum InterpretResult run(struct hs_State* H) {
         }
         break;
       }
+      case BC_INEQUALITY_JUMP_LONG: {
+        u32 offset = READ_LONG();
+        Value b = pop(H);
+        Value a = peek(H, 0);
+        if (!valuesEqual(a, b)) {
+          frame->ip += offset;
+        }
+        break;
+      }
       case BC_LOOP: {
         u16 offset = READ_SHORT();
+        if (--H->fuel <= 0 && !refuel(H)) {
+          return RUNTIME_ERR;
+        }
+        frame->ip -= offset;
+        break;
+      }
+      case BC_LOOP_LONG: {
+        u32 offset = READ_LONG();
+        if (--H->fuel <= 0 && !refuel(H)) {
+          return RUNTIME_ERR;
+        }
         frame->ip -= offset;
         break;
       }
+      case BC_FOR_PREP:
+      case BC_FOR_PREP_LONG: {
+        Value* iter = frame->slots
+            + (instruction == BC_FOR_PREP ? READ_BYTE() : READ_SHORT());
+        if (!IS_ARRAY(iter[0]) && !IS_ARRAY_VIEW(iter[0]) && !IS_NUM_ARRAY(iter[0])
+            && !IS_INSTANCE(iter[0]) && !IS_ENUM(iter[0])) {
+          runtimeError(H, "Can only iterate over arrays, instances and enums.");
+          return RUNTIME_ERR;
+        }
+        iter[1] = NEW_NUMBER(-1);
+        break;
+      }
+      case BC_FOR_ITER:
+      case BC_FOR_ITER_LONG: {
+        // Slots are [iterable, cursor, key, value]. BC_FOR_PREP already
+        // checked the iterable's type.
+        Value* iter;
+        u32 offset;
+        if (instruction == BC_FOR_ITER) {
+          iter = frame->slots + READ_BYTE();
+          offset = READ_SHORT();
+        } else {
+          iter = frame->slots + READ_SHORT();
+          offset = READ_LONG();
+        }
+        s32 cursor = (s32)AS_NUMBER(iter[1]) + 1;
+        // Each iteration gets its own key and value, so closures made in
+        // the last one keep what they saw.
+        closeUpvalues(H, iter + 2);
+
+        switch (OBJ_TYPE(iter[0])) {
+          case OBJ_ARRAY: {
+            struct ValueArray* values = &AS_ARRAY(iter[0])->values;
+            if (cursor >= values->count) {
+              frame->ip += offset;
+              break;
+            }
+            iter[2] = NEW_NUMBER(cursor);
+            iter[3] = values->values[cursor];
+            break;
+          }
+          case OBJ_ARRAY_VIEW: {
+            struct GcArrayView* view = AS_ARRAY_VIEW(iter[0]);
+            if (cursor >= arrayViewCount(view)) {
+              frame->ip += offset;
+              break;
+            }
+            iter[2] = NEW_NUMBER(cursor);
+            iter[3] = view->parent->values.values[view->start + cursor];
+            break;
+          }
+          case OBJ_NUM_ARRAY: {
+            struct GcNumArray* array = AS_NUM_ARRAY(iter[0]);
+            if (cursor >= array->count) {
+              frame->ip += offset;
+              break;
+            }
+            iter[2] = NEW_NUMBER(cursor);
+            iter[3] = NEW_NUMBER(numArrayGet(array, cursor));
+            break;
+          }
+          default: {
+            struct Table* table = IS_INSTANCE(iter[0])
+                ? &AS_INSTANCE(iter[0])->fields
+                : &AS_ENUM(iter[0])->values;
+            while (cursor < table->capacity && table->entries[cursor].key == NULL) {
+              cursor++;
+            }
+            if (cursor >= table->capacity) {
+              frame->ip += offset;
+              break;
+            }
+            iter[2] = NEW_OBJ(table->entries[cursor].key);
+            iter[3] = table->entries[cursor].value;
+            break;
+          }
+        }
+
+        iter[1] = NEW_NUMBER(cursor);
+        break;
+      }
       case BC_CALL: {
         s32 argCount = READ_BYTE();
         if (!callValue(H, peek(H, argCount), argCount)) {
@@ -601,14 +1139,16 @@ static enum InterpretResult run(struct hs_State* H) {
         push(H, instance);
         break;
       }
-      case BC_CLOSURE: {
-        struct GcBcFunction* function = AS_FUNCTION(READ_CONSTANT());
+      case BC_CLOSURE:
+      case BC_CLOSURE_LONG: {
+        struct GcBcFunction* function = AS_FUNCTION(
+            instruction == BC_CLOSURE ? READ_CONSTANT() : READ_CONSTANT_LONG());
         struct GcClosure* closure = newClosure(H, function);
         push(H, NEW_OBJ(closure));
         for (s32 i = 0; i < closure->upvalueCount; i++) {
-          u8 isLocal = READ_BYTE();
-          u8 index = READ_BYTE();
-          if (isLocal) {
+          u8 flags = READ_BYTE();
+          u16 index = flags & UPVALUE_WIDE ? READ_SHORT() : READ_BYTE();
+          if (flags & UPVALUE_LOCAL) {
             closure->upvalues[i] = captureUpvalue(H, frame->slots + index);
           } else {
             closure->upvalues[i] = frame->func->upvalues[index];
@@ -624,44 +1164,75 @@ static enum InterpretResult run(struct hs_State* H) {
       case BC_RETURN: {
         Value result = pop(H);
         closeUpvalues(H, frame->slots);
+        if (frame->tracedAt != 0) {
+          traceReturn(H, frame);
+        }
         H->frameCount--;
-        if (H->frameCount == 0) {
-          pop(H);
+        H->stackTop = frame->slots;
+        if (H->frameCount == 0 && H->fiber->caller != NULL) {
+          // The fiber's function returned, so the fiber is finished.
+          returnToCaller(H, FIBER_DONE, result);
+        } else {
+          push(H, result);
+        }
+        if (H->frameCount == baseFrame && H->fiber == baseFiber) {
           return INTERPRET_OK;
         }
 
-        H->stackTop = frame->slots;
-        push(H, result);
         frame = &H->frames[H->frameCount - 1];
         break;
       }
-      case BC_ENUM: {
-        push(H, NEW_OBJ(newEnum(H, READ_STRING())));
+      case BC_YIELD: {
+        if (!yieldFiber(H, pop(H))) {
+          return RUNTIME_ERR;
+        }
+        if (H->frameCount == baseFrame && H->fiber == baseFiber) {
+          return INTERPRET_OK;
+        }
+
+        frame = &H->frames[H->frameCount - 1];
+        break;
+      }
+      case BC_RESUME: {
+        if (!resumeFiber(H, READ_BYTE() - 1)) {
+          return RUNTIME_ERR;
+        }
+        frame = &H->frames[H->frameCount - 1];
+        break;
+      }
+      case BC_ENUM:
+      case BC_ENUM_LONG: {
+        push(H, NEW_OBJ(newEnum(H, READ_NAME(BC_ENUM))));
         break;
       }
-      case BC_ENUM_VALUE: {
+      case BC_ENUM_VALUE:
+      case BC_ENUM_VALUE_LONG: {
         struct GcEnum* enoom = AS_ENUM(peek(H, 0));
-        struct GcString* name = READ_STRING();
+        struct GcString* name = READ_NAME(BC_ENUM_VALUE);
         f64 value = (f64)READ_BYTE();
         tableSet(H, &enoom->values, name, NEW_NUMBER(value));
         break;
       }
-      case BC_STRUCT: {
-        push(H, NEW_OBJ(newStruct(H, READ_STRING())));
+      case BC_STRUCT:
+      case BC_STRUCT_LONG: {
+        push(H, NEW_OBJ(newStruct(H, READ_NAME(BC_STRUCT))));
         break;
       }
-      case BC_METHOD: {
+      case BC_METHOD:
+      case BC_METHOD_LONG: {
         struct GcStruct* strooct = AS_STRUCT(peek(H, 1));
-        defineMethod(H, READ_STRING(), &strooct->methods);
+        defineMethod(H, READ_NAME(BC_METHOD), &strooct->methods);
         break;
       }
-      case BC_STATIC_METHOD: {
+      case BC_STATIC_METHOD:
+      case BC_STATIC_METHOD_LONG: {
         struct GcStruct* strooct = AS_STRUCT(peek(H, 1));
-        defineMethod(H, READ_STRING(), &strooct->staticMethods);
+        defineMethod(H, READ_NAME(BC_STATIC_METHOD), &strooct->staticMethods);
         break;
       }
-      case BC_INVOKE: {
-        struct GcString* method = READ_STRING();
+      case BC_INVOKE:
+      case BC_INVOKE_LONG: {
+        struct GcString* method = READ_NAME(BC_INVOKE);
         s32 argCount = READ_BYTE();
         if (!invoke(H, method, argCount)) {
           return RUNTIME_ERR;
@@ -669,8 +1240,9 @@ static enum InterpretResult run(struct hs_State* H) {
         frame = &H->frames[H->frameCount - 1];
         break;
       }
-      case BC_STRUCT_FIELD: {
-        struct GcString* key = READ_STRING();
+      case BC_STRUCT_FIELD:
+      case BC_STRUCT_FIELD_LONG: {
+        struct GcString* key = READ_NAME(BC_STRUCT_FIELD);
         Value defaultValue = pop(H);
         struct GcStruct* strooct = AS_STRUCT(peek(H, 0));
         tableSet(H, &strooct->defaultFields, key, defaultValue);
@@ -688,6 +1260,10 @@ static enum InterpretResult run(struct hs_State* H) {
 #undef READ_SHORT
 #undef READ_CONSTANT
 #undef READ_STRING
+#undef READ_LONG
+#undef READ_CONSTANT_LONG
+#undef READ_STRING_LONG
+#undef READ_NAME
 #undef BINARY_OP
 }
 
@@ -701,8 +1277,48 @@ enum InterpretResult interpret(struct hs_State* H, const char* source) {
   struct GcClosure* closure = newClosure(H, function);
   pop(H);
   push(H, NEW_OBJ(closure));
-  call(H, closure, 0);
+  if (!call(H, closure, 0)) {
+    return RUNTIME_ERR;
+  }
+
+  enum InterpretResult result = run(H, H->fiber, 0);
+  if (result == INTERPRET_OK) {
+    pop(H); // Script result
+  }
+  return result;
+}
+
+// Runs the VM nested inside C code, which the running fiber can't yield
+// across.
+static bool runFromC(struct hs_State* H, struct GcFiber* fiber, s32 baseFrame) {
+  fiber->nativeDepth++;
+  bool ok = run(H, fiber, baseFrame) == INTERPRET_OK;
+  fiber->nativeDepth--;
+  return ok;
+}
+
+bool callFromC(struct hs_State* H, s32 argCount) {
+  struct GcFiber* fiber = H->fiber;
+  s32 baseFrame = H->frameCount;
+  if (!callValue(H, peek(H, argCount), argCount)) {
+    return false;
+  }
+
+  // C functions finish inside callValue.
+  if (H->frameCount == baseFrame) {
+    return true;
+  }
+
+  return runFromC(H, fiber, baseFrame);
+}
+
+bool resumeFromC(struct hs_State* H, s32 argCount) {
+  struct GcFiber* fiber = H->fiber;
+  s32 baseFrame = H->frameCount;
+  if (!resumeFiber(H, argCount)) {
+    return false;
+  }
 
-  return run(H);
+  return runFromC(H, fiber, baseFrame);
 }
 
@@ -10,5 +10,8 @@ enum InterpretResult {
 };
 
 enum InterpretResult interpret(struct hs_State* H, const char* source);
+void runtimeError(struct hs_State* H, const char* format, ...);
+bool callFromC(struct hs_State* H, s32 argCount);
+bool resumeFromC(struct hs_State* H, s32 argCount);
 
 #endif // _HOBBYSCRIPT_VM_H
@@ -175,8 +175,7 @@ class Test:
 
         # Validate that an expected runtime error occurred.
         if self.runtime_error_message:
-            pass
-            # self.validate_runtime_error(error_lines)
+            self.validate_runtime_error(error_lines)
         else:
             self.validate_compile_errors(error_lines)
 
@@ -189,39 +188,36 @@ class Test:
 
 
     def validate_runtime_error(self, error_lines):
-        if len(error_lines) < 2:
-            self.fail('Expected runtime error "{0}" and got none.',
+        # The trace comes before the message and runs from the outermost call
+        # inwards, so the innermost frame is the last one. Errors a task
+        # handles print no trace, just the message after "Task failed: ".
+        trace = []
+        messages = []
+        for line in error_lines:
+            match = STACK_TRACE_PATTERN.search(line)
+            if match:
+                trace.append(int(match.group(1)))
+            elif line and not ERROR_PATTERN.search(line):
+                messages.append(line[len('Task failed: '):]
+                                if line.startswith('Task failed: ') else line)
+
+        # Annotations may leave off the message's final period.
+        expected = self.runtime_error_message
+        if expected not in messages and expected + '.' not in messages:
+            self.fail('Expected runtime error "{0}" and got:',
                 self.runtime_error_message)
-            return
+            for message in messages:
+                self.fail(message)
 
-        # Skip any compile errors. This can happen if there is a compile error in
-        # a module loaded by the module being tested.
-        line = 0
-        while ERROR_PATTERN.search(error_lines[line]):
-            line += 1
+        if not trace:
+            if self.exit_code == 70:
+                self.fail('Expected a stack trace for runtime error "{0}" and got none.',
+                    self.runtime_error_message)
+            return
 
-        if error_lines[line] != self.runtime_error_message:
-            self.fail('Expected runtime error "{0}" and got:',
-                self.runtime_error_message)
-            self.fail(error_lines[line])
-
-        # Make sure the stack trace has the right line. Skip over any lines that
-        # come from builtin libraries.
-        match = False
-        stack_lines = error_lines[line + 1:]
-        for stack_line in stack_lines:
-            match = STACK_TRACE_PATTERN.search(stack_line)
-            if match: break
-
-        if not match:
-            self.fail('Expected stack trace and got:')
-            for stack_line in stack_lines:
-                self.fail(stack_line)
-        else:
-            stack_line = int(match.group(1))
-            if stack_line != self.runtime_error_line:
-                self.fail('Expected runtime error on line {0} but was on line {1}.',
-                    self.runtime_error_line, stack_line)
+        if trace[-1] != self.runtime_error_line:
+            self.fail('Expected runtime error on line {0} but was on line {1}.',
+                self.runtime_error_line, trace[-1])
 
 
     def validate_compile_errors(self, error_lines):
@@ -0,0 +1,194 @@
+// Moves arrays and number arrays between C and scripts in both directions,
+// and checks that counts, kinds and indexes the API can't honour are
+// refused without touching the stack below.
+
+#include <stdint.h>
+
+#include "check.h"
+#include "hobbyscript.h"
+#include "vm.h"
+
+#define SENTINEL 12345
+
+static const char* script =
+  "global func packed() { return pack(1, 2, 3); }\n"
+  "global func overpacked() { return overpack(1, 2); }\n"
+  "global func mixed() { return [1, 2, \"three\", 4]; }\n"
+  "global func total(a) { return a.sum(); }\n"
+  "global func doubled(a) {\n"
+  "  a.scale(2);\n"
+  "  return a;\n"
+  "}\n";
+
+// Packs its arguments into an array.
+static void pack(struct hs_State* H, int argCount) {
+  hs_newArray(H, argCount);
+}
+
+// Asks for one value more than it was passed.
+static void overpack(struct hs_State* H, int argCount) {
+  hs_newArray(H, argCount + 1);
+}
+
+static bool sentinelAt(struct hs_State* H, int index) {
+  return hs_isNumber(H, index) && hs_toNumber(H, index) == SENTINEL;
+}
+
+static void testNewArray(struct hs_State* H) {
+  hs_pushNumber(H, SENTINEL);
+
+  hs_pushNumber(H, 1);
+  hs_pushString(H, "two", 3);
+  hs_pushNumber(H, 3);
+  hs_newArray(H, 3);
+  CHECK(hs_isArray(H, -1));
+  CHECK(hs_arrayLength(H, -1) == 3);
+  CHECK(sentinelAt(H, -2));
+  double out[3];
+  CHECK(hs_readNumbers(H, -1, 0, out, 3) == 1);
+  CHECK(out[0] == 1);
+  CHECK(hs_readNumbers(H, -1, 2, out, 3) == 1);
+  CHECK(out[0] == 3);
+  hs_pop(H);
+
+  hs_newArray(H, 0);
+  CHECK(hs_isArray(H, -1));
+  CHECK(hs_arrayLength(H, -1) == 0);
+  hs_pop(H);
+
+  // Bad counts push nil and pop nothing.
+  hs_newArray(H, -1);
+  CHECK(!hs_isArray(H, -1));
+  CHECK(sentinelAt(H, -2));
+  hs_pop(H);
+  hs_pushNumber(H, 1);
+  hs_newArray(H, 1000);
+  CHECK(!hs_isArray(H, -1));
+  CHECK(hs_toNumber(H, -2) == 1);
+  CHECK(sentinelAt(H, -3));
+  hs_pop(H);
+  hs_pop(H);
+
+  // Inside a C function only its arguments can be taken.
+  hs_getGlobal(H, "packed");
+  CHECK(hs_pcall(H, 0, 1) == HS_OK);
+  CHECK(hs_readNumbers(H, -1, 0, out, 3) == 3);
+  CHECK(out[0] == 1 && out[1] == 2 && out[2] == 3);
+  hs_pop(H);
+  hs_getGlobal(H, "overpacked");
+  CHECK(hs_pcall(H, 0, 1) == HS_OK);
+  CHECK(!hs_isArray(H, -1));
+  CHECK(sentinelAt(H, -2));
+  hs_pop(H);
+
+  hs_pop(H);
+}
+
+static void testNumbers(struct hs_State* H) {
+  double numbers[1000];
+  for (int i = 0; i < 1000; i++) {
+    numbers[i] = i * 0.5;
+  }
+
+  hs_pushNumbers(H, numbers, 1000);
+  CHECK(hs_arrayLength(H, -1) == 1000);
+  double out[8] = {0};
+  CHECK(hs_readNumbers(H, -1, 10, out, 5) == 5);
+  CHECK(out[0] == 5 && out[4] == 7);
+  CHECK(hs_readNumbers(H, -1, 998, out, 8) == 2);
+  CHECK(out[1] == 499.5);
+  CHECK(hs_readNumbers(H, -1, 1000, out, 8) == 0);
+  CHECK(hs_readNumbers(H, -1, SIZE_MAX, out, 8) == 0);
+  hs_pop(H);
+
+  hs_pushNumbers(H, NULL, 0);
+  CHECK(hs_isArray(H, -1));
+  CHECK(hs_arrayLength(H, -1) == 0);
+  hs_pop(H);
+
+  // Too many for an array, and never read.
+  hs_pushNumbers(H, numbers, (size_t)INT32_MAX + 1);
+  CHECK(!hs_isArray(H, -1));
+  hs_pop(H);
+
+  // Reading stops at the first value that isn't a number.
+  hs_getGlobal(H, "mixed");
+  CHECK(hs_pcall(H, 0, 1) == HS_OK);
+  CHECK(hs_readNumbers(H, -1, 0, out, 8) == 2);
+  CHECK(hs_readNumbers(H, -1, 3, out, 8) == 1);
+  CHECK(out[0] == 4);
+  hs_pop(H);
+
+  hs_pushNumber(H, 1);
+  CHECK(hs_arrayLength(H, -1) == 0);
+  CHECK(hs_readNumbers(H, -1, 0, out, 8) == 0);
+  hs_pop(H);
+}
+
+static void testNumArrays(struct hs_State* H) {
+  float* f32 = hs_pushNumArray(H, HS_F32, 4);
+  CHECK(f32 != NULL);
+  for (int i = 0; i < 4; i++) {
+    CHECK(f32[i] == 0);
+    f32[i] = i + 1;
+  }
+  hs_setGlobal(H, "floats");
+
+  hs_getGlobal(H, "total");
+  hs_getGlobal(H, "floats");
+  CHECK(hs_pcall(H, 1, 1) == HS_OK);
+  CHECK(hs_toNumber(H, -1) == 10);
+  hs_pop(H);
+
+  // Scripts write through to the same storage.
+  hs_getGlobal(H, "doubled");
+  hs_getGlobal(H, "floats");
+  CHECK(hs_pcall(H, 1, 1) == HS_OK);
+  size_t count = 0;
+  CHECK(hs_toNumArray(H, -1, HS_F32, &count) == f32);
+  CHECK(count == 4);
+  CHECK(f32[3] == 8);
+  CHECK(hs_toNumArray(H, -1, HS_F64, NULL) == NULL);
+  CHECK(hs_toNumArray(H, -1, HS_I32, NULL) == NULL);
+  hs_pop(H);
+
+  int32_t* i32 = hs_pushNumArray(H, HS_I32, 3);
+  i32[0] = -5;
+  i32[2] = 7;
+  CHECK(hs_toNumArray(H, -1, HS_I32, &count) == i32);
+  CHECK(count == 3);
+  hs_getGlobal(H, "total");
+  hs_push(H, -2);
+  CHECK(hs_pcall(H, 1, 1) == HS_OK);
+  CHECK(hs_toNumber(H, -1) == 2);
+  hs_pop(H);
+  hs_pop(H);
+
+  CHECK(hs_pushNumArray(H, HS_F64, (size_t)INT32_MAX + 1) == NULL);
+  CHECK(!hs_isArray(H, -1));
+  hs_pop(H);
+  CHECK(hs_pushNumArray(H, (enum hs_NumArrayKind)7, 4) == NULL);
+  hs_pop(H);
+
+  hs_pushNumbers(H, NULL, 0);
+  CHECK(hs_toNumArray(H, -1, HS_F64, NULL) == NULL);
+  hs_pop(H);
+}
+
+int main() {
+  struct hs_State* H = hs_newState();
+  struct hs_FuncInfo natives[] = {
+    {pack, "pack", -1},
+    {overpack, "overpack", -1},
+    {NULL, NULL, 0},
+  };
+  hs_registerGlobalFunctions(H, natives);
+  CHECK(interpret(H, script) == INTERPRET_OK);
+
+  testNewArray(H);
+  testNumbers(H);
+  testNumArrays(H);
+
+  hs_freeState(H);
+  return finishChecks("arrays");
+}
@@ -0,0 +1,150 @@
+// Runs scripts against the fuel and memory limits and hs_interrupt(), and
+// checks that each stops them with an error hs_pcall() catches, after which
+// the state still works.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <time.h>
+
+#include "check.h"
+#include "hobbyscript.h"
+#include "vm.h"
+
+#define MEMORY_LIMIT (8 << 20)
+
+static const char* script =
+  "global func spin() { while (true) {} }\n"
+  "global func count(n) {\n"
+  "  var i = 0;\n"
+  "  while (i < n) { i += 1; }\n"
+  "  return i;\n"
+  "}\n"
+  "global func grow() {\n"
+  "  var a = [];\n"
+  "  while (true) { a.push(toString(a.len())); }\n"
+  "}\n"
+  "global func reserve(n) {\n"
+  "  var a = [];\n"
+  "  a.reserve(n);\n"
+  "  return a;\n"
+  "}\n"
+  "global func numbers(n) { return f64Array(n); }\n"
+  "global func fibers(n) {\n"
+  "  var kept = [];\n"
+  "  var i = 0;\n"
+  "  while (i < n) {\n"
+  "    var f = fiber(func() { return 1; });\n"
+  "    if (i % 2 == 0) { resume(f); }\n"
+  "    kept.push(f);\n"
+  "    i += 1;\n"
+  "  }\n"
+  "  return kept.len();\n"
+  "}\n";
+
+// Calls the global with a number argument, and leaves its result or error
+// message on top of the stack.
+static enum hs_Status callGlobal(struct hs_State* H, const char* name, double arg) {
+  hs_getGlobal(H, name);
+  hs_pushNumber(H, arg);
+  return hs_pcall(H, 1, 1);
+}
+
+static bool countsTo(struct hs_State* H, double n) {
+  bool ok = callGlobal(H, "count", n) == HS_OK && hs_toNumber(H, -1) == n;
+  hs_pop(H);
+  return ok;
+}
+
+static void testFuel(struct hs_State* H) {
+  hs_setFuel(H, 1000);
+  hs_getGlobal(H, "spin");
+  CHECK(hs_pcall(H, 0, 1) == HS_RUNTIME_ERROR);
+  CHECK(isString(H, -1, "Out of fuel."));
+  CHECK(hs_getFuel(H) == 0);
+  hs_pop(H);
+
+  // Still empty until it's refilled.
+  CHECK(callGlobal(H, "count", 10000) == HS_RUNTIME_ERROR);
+  hs_pop(H);
+
+  hs_setFuel(H, 100000);
+  CHECK(countsTo(H, 100));
+  CHECK(hs_getFuel(H) < 100000);
+  CHECK(hs_getFuel(H) > 99000);
+
+  hs_setFuel(H, -1);
+  CHECK(hs_getFuel(H) == -1);
+  CHECK(countsTo(H, 100000));
+}
+
+static void testMemory(struct hs_State* H) {
+  hs_setMemoryLimit(H, MEMORY_LIMIT);
+
+  hs_getGlobal(H, "grow");
+  CHECK(hs_pcall(H, 0, 1) == HS_RUNTIME_ERROR);
+  CHECK(isString(H, -1, "Out of memory."));
+  hs_pop(H);
+  CHECK(countsTo(H, 1000));
+
+  // Sizes the script picks are refused before anything is allocated.
+  CHECK(callGlobal(H, "reserve", 50000000) == HS_RUNTIME_ERROR);
+  CHECK(isString(H, -1, "Out of memory."));
+  hs_pop(H);
+  CHECK(callGlobal(H, "numbers", 50000000) == HS_RUNTIME_ERROR);
+  CHECK(isString(H, -1, "Out of memory."));
+  hs_pop(H);
+  CHECK(hs_pushNumArray(H, HS_F64, 50000000) == NULL);
+  CHECK(!hs_isArray(H, -1));
+  hs_pop(H);
+
+  struct hs_GcStats stats;
+  hs_gcStats(H, &stats);
+  CHECK(stats.bytesAfter < MEMORY_LIMIT);
+
+  // Smaller ones still fit.
+  CHECK(callGlobal(H, "reserve", 1000) == HS_OK);
+  hs_pop(H);
+  CHECK(callGlobal(H, "numbers", 1000) == HS_OK);
+  hs_pop(H);
+
+  // Fibers that haven't started or have finished don't hold a stack.
+  CHECK(callGlobal(H, "fibers", 2000) == HS_OK);
+  CHECK(hs_toNumber(H, -1) == 2000);
+  hs_pop(H);
+
+  hs_setMemoryLimit(H, 0);
+  CHECK(callGlobal(H, "reserve", 1000000) == HS_OK);
+  hs_pop(H);
+}
+
+static void* interruptLater(void* arg) {
+  struct timespec delay = {0, 20 * 1000000};
+  nanosleep(&delay, NULL);
+  hs_interrupt((struct hs_State*)arg);
+  return NULL;
+}
+
+static void testInterrupt(struct hs_State* H) {
+  pthread_t thread;
+  pthread_create(&thread, NULL, interruptLater, H);
+  hs_getGlobal(H, "spin");
+  CHECK(hs_pcall(H, 0, 1) == HS_RUNTIME_ERROR);
+  CHECK(isString(H, -1, "Interrupted."));
+  hs_pop(H);
+  pthread_join(thread, NULL);
+
+  CHECK(countsTo(H, 100000));
+}
+
+int main() {
+  struct hs_State* H = hs_newState();
+  CHECK(interpret(H, script) == INTERPRET_OK);
+
+  testFuel(H);
+  testMemory(H);
+  testInterrupt(H);
+
+  hs_freeState(H);
+  return finishChecks("budgets");
+}
@@ -0,0 +1,231 @@
+// Calls script functions from C with hs_getGlobal(), hs_call() and
+// hs_pcall(), including errors raised in callbacks the VM makes back into
+// scripts, and checks the stack is left as documented each time.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+
+#include "check.h"
+#include "hobbyscript.h"
+#include "vm.h"
+
+#define SENTINEL 12345
+
+static const char* script =
+  "global func add(a, b) { return a + b; }\n"
+  "global func fail(message) { return message .. nope; }\n"
+  "global func sorted(values, comparator) {\n"
+  "  values.sort(comparator);\n"
+  "  return values;\n"
+  "}\n"
+  "global func badComparator(a, b) { return a < missing; }\n"
+  "global func descending(a, b) { return a > b; }\n"
+  "global func callBack(f) { return protect(f); }\n"
+  "global func deepFail(n) {\n"
+  "  if (n == 0) return nope;\n"
+  "  return deepFail(n - 1);\n"
+  "}\n"
+  "global func protectInFiber(n) {\n"
+  "  var f = fiber(func() {\n"
+  "    return protect(func() { return deepFail(n); }) .. \" caught\";\n"
+  "  });\n"
+  "  return resume(f);\n"
+  "}\n";
+
+// Calls its argument in a protected call and returns the error message, so
+// scripts can see errors raised in nested calls.
+static void protect(struct hs_State* H, int argCount) {
+  (void)argCount;
+  hs_push(H, 1);
+  if (hs_pcall(H, 0, 1) != HS_RUNTIME_ERROR) {
+    hs_pop(H);
+    hs_pushString(H, "no error", 8);
+  }
+}
+
+static bool sentinelAt(struct hs_State* H, int index) {
+  return hs_isNumber(H, index) && hs_toNumber(H, index) == SENTINEL;
+}
+
+static void pushNumbers(struct hs_State* H, int count) {
+  for (int i = count; i > 0; i--) {
+    hs_pushNumber(H, i);
+  }
+  hs_newArray(H, count);
+}
+
+static void testResults(struct hs_State* H) {
+  hs_pushNumber(H, SENTINEL);
+
+  CHECK(hs_getGlobal(H, "add"));
+  hs_pushNumber(H, 1);
+  hs_pushNumber(H, 2);
+  CHECK(hs_pcall(H, 2, 1) == HS_OK);
+  CHECK(hs_toNumber(H, -1) == 3);
+  CHECK(sentinelAt(H, -2));
+  hs_pop(H);
+
+  // Extra results are padded with nil.
+  hs_getGlobal(H, "add");
+  hs_pushNumber(H, 1);
+  hs_pushNumber(H, 2);
+  CHECK(hs_call(H, 2, 3));
+  CHECK(hs_toNumber(H, -3) == 3);
+  CHECK(!hs_isNumber(H, -2));
+  CHECK(!hs_isNumber(H, -1));
+  CHECK(sentinelAt(H, -4));
+  hs_pop(H);
+  hs_pop(H);
+  hs_pop(H);
+
+  // And no results drops the one there is.
+  hs_getGlobal(H, "add");
+  hs_pushNumber(H, 1);
+  hs_pushNumber(H, 2);
+  CHECK(hs_pcall(H, 2, 0) == HS_OK);
+  CHECK(sentinelAt(H, -1));
+
+  CHECK(!hs_getGlobal(H, "undefined"));
+  CHECK(!hs_isNumber(H, -1));
+  hs_pop(H);
+
+  // Indexes outside the frame push nil.
+  hs_push(H, 100);
+  CHECK(!hs_isNumber(H, -1));
+  hs_pop(H);
+  hs_push(H, -100);
+  CHECK(!hs_isNumber(H, -1));
+  hs_pop(H);
+  hs_push(H, -1);
+  CHECK(sentinelAt(H, -1));
+  hs_pop(H);
+  hs_pop(H);
+}
+
+static void testErrors(struct hs_State* H) {
+  hs_pushNumber(H, SENTINEL);
+
+  // The message replaces the function and its arguments.
+  hs_getGlobal(H, "fail");
+  hs_pushString(H, "x", 1);
+  CHECK(hs_pcall(H, 1, 3) == HS_RUNTIME_ERROR);
+  CHECK(isString(H, -1, "Undefined variable 'nope'."));
+  CHECK(sentinelAt(H, -2));
+  hs_pop(H);
+
+  hs_pushNumber(H, 3);
+  CHECK(hs_pcall(H, 0, 1) == HS_RUNTIME_ERROR);
+  CHECK(isString(H, -1, "Can only call functions."));
+  CHECK(sentinelAt(H, -2));
+  hs_pop(H);
+
+  hs_getGlobal(H, "add");
+  hs_pushNumber(H, 1);
+  CHECK(hs_pcall(H, 1, 1) == HS_RUNTIME_ERROR);
+  CHECK(isString(H, -1, "Expected 2 arguments, but got 1."));
+  CHECK(sentinelAt(H, -2));
+  hs_pop(H);
+
+  // The state still works afterwards.
+  hs_getGlobal(H, "add");
+  hs_pushNumber(H, 4);
+  hs_pushNumber(H, 5);
+  CHECK(hs_pcall(H, 2, 1) == HS_OK);
+  CHECK(hs_toNumber(H, -1) == 9);
+  CHECK(sentinelAt(H, -2));
+  hs_pop(H);
+  hs_pop(H);
+}
+
+static void testCallbacks(struct hs_State* H) {
+  hs_pushNumber(H, SENTINEL);
+
+  // sort() calls the comparator back from C, and the error unwinds it.
+  hs_getGlobal(H, "sorted");
+  pushNumbers(H, 50);
+  hs_getGlobal(H, "badComparator");
+  CHECK(hs_pcall(H, 2, 1) == HS_RUNTIME_ERROR);
+  CHECK(isString(H, -1, "Undefined variable 'missing'."));
+  CHECK(sentinelAt(H, -2));
+  hs_pop(H);
+
+  hs_getGlobal(H, "sorted");
+  pushNumbers(H, 50);
+  hs_getGlobal(H, "descending");
+  CHECK(hs_pcall(H, 2, 1) == HS_OK);
+  CHECK(hs_arrayLength(H, -1) == 50);
+  double first[2];
+  CHECK(hs_readNumbers(H, -1, 0, first, 2) == 2);
+  CHECK(first[0] == 50 && first[1] == 49);
+  CHECK(sentinelAt(H, -2));
+  hs_pop(H);
+
+  // A protected call inside a native only unwinds to that native.
+  hs_getGlobal(H, "callBack");
+  hs_getGlobal(H, "fail");
+  CHECK(hs_pcall(H, 1, 1) == HS_OK);
+  CHECK(isString(H, -1, "Expected 1 arguments, but got 0."));
+  CHECK(sentinelAt(H, -2));
+  hs_pop(H);
+
+  // Errors unwind to the right place after a fiber's stack grew and moved.
+  hs_getGlobal(H, "protectInFiber");
+  hs_pushNumber(H, 40);
+  CHECK(hs_pcall(H, 1, 1) == HS_OK);
+  CHECK(isString(H, -1, "Undefined variable 'nope'. caught"));
+  CHECK(sentinelAt(H, -2));
+  hs_pop(H);
+
+  hs_getGlobal(H, "deepFail");
+  CHECK(hs_newFiber(H));
+  hs_pushNumber(H, 40);
+  CHECK(hs_resume(H, 1) == HS_RUNTIME_ERROR);
+  CHECK(isString(H, -1, "Undefined variable 'nope'."));
+  CHECK(sentinelAt(H, -2));
+  hs_pop(H);
+  hs_pop(H);
+}
+
+static void testUnprotected(struct hs_State* H, FILE* err) {
+  // hs_call() reports the error and resets the stack.
+  hs_pushNumber(H, SENTINEL);
+  hs_getGlobal(H, "fail");
+  hs_pushString(H, "x", 1);
+  CHECK(!hs_call(H, 1, 1));
+  fflush(err);
+
+  hs_getGlobal(H, "add");
+  hs_pushNumber(H, 1);
+  hs_pushNumber(H, 1);
+  CHECK(hs_call(H, 2, 1));
+  CHECK(hs_toNumber(H, -1) == 2);
+  CHECK(!sentinelAt(H, -2));
+  hs_pop(H);
+}
+
+int main() {
+  char* errors = NULL;
+  size_t errorsSize = 0;
+  FILE* err = open_memstream(&errors, &errorsSize);
+
+  struct hs_State* H = hs_newState();
+  hs_setOutput(H, stdout, err);
+  struct hs_FuncInfo natives[] = {
+    {protect, "protect", 1},
+    {NULL, NULL, 0},
+  };
+  hs_registerGlobalFunctions(H, natives);
+  CHECK(interpret(H, script) == INTERPRET_OK);
+
+  testResults(H);
+  testErrors(H);
+  testCallbacks(H);
+  testUnprotected(H, err);
+  CHECK(strstr(errors, "Undefined variable 'nope'.") != NULL);
+
+  hs_freeState(H);
+  fclose(err);
+  free(errors);
+  return finishChecks("calls");
+}
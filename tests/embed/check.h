@@ -0,0 +1,62 @@
+// Shared by the embedding tests. Each one is a program that drives a state
+// through the public API, checks what comes back with CHECK(), and ends by
+// returning finishChecks().
+
+#ifndef _HOBBYSCRIPT_TEST_CHECK_H
+#define _HOBBYSCRIPT_TEST_CHECK_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "hobbyscript.h"
+
+#define CHECK(condition) check((condition), #condition, __FILE__, __LINE__)
+
+static int checkCount = 0;
+static int checkFailures = 0;
+
+static inline void check(
+    bool ok, const char* what, const char* file, int line) {
+  checkCount++;
+  if (!ok) {
+    checkFailures++;
+    fprintf(stderr, "%s:%d: check failed: %s\n", file, line, what);
+  }
+}
+
+// Whether the value at index is the string expected.
+static inline bool isString(struct hs_State* H, int index, const char* expected) {
+  if (!hs_isString(H, index)) {
+    return false;
+  }
+  size_t length;
+  const char* chars = hs_toString(H, index, &length);
+  return length == strlen(expected) && memcmp(chars, expected, length) == 0;
+}
+
+// Allocates garbage until the collector has run at least once more.
+static inline void collect(struct hs_State* H) {
+  static int made = 0;
+  struct hs_GcStats stats;
+  hs_gcStats(H, &stats);
+  uint64_t before = stats.collections;
+  while (stats.collections == before) {
+    char chars[32];
+    int length = snprintf(chars, sizeof(chars), "garbage %d", made++);
+    hs_pushString(H, chars, length);
+    hs_pop(H);
+    hs_gcStats(H, &stats);
+  }
+}
+
+static inline int finishChecks(const char* name) {
+  if (checkFailures > 0) {
+    fprintf(stderr, "%s: %d of %d checks failed.\n", name, checkFailures, checkCount);
+    return 1;
+  }
+  printf("%s: %d checks passed.\n", name, checkCount);
+  return 0;
+}
+
+#endif // _HOBBYSCRIPT_TEST_CHECK_H
@@ -0,0 +1,79 @@
+// Runs tasks through hs_spawn() and hs_schedulerTick(), and checks that
+// fibers can't be queued twice and that sleeps of any length are filed
+// where they belong.
+
+#include "check.h"
+#include "hobbyscript.h"
+#include "vm.h"
+
+static const char* script =
+  "global func forever() { yield 1 / 0; }\n"
+  "global func longSleep() { yield 100000000000000000000; }\n"
+  "global func backwards() { yield -1; }\n"
+  "global func notANumber() { yield 0 / 0; }\n";
+
+static struct hs_SchedulerStats tick(struct hs_State* H) {
+  struct hs_SchedulerStats stats;
+  hs_schedulerTick(H, UINT64_MAX);
+  hs_schedulerStats(H, &stats);
+  return stats;
+}
+
+static void testSpawnTwice(struct hs_State* H) {
+  hs_getGlobal(H, "backwards");
+  CHECK(hs_newFiber(H));
+  hs_push(H, -1);
+  CHECK(hs_spawn(H));
+  // The second copy is still on the stack when refused.
+  CHECK(!hs_spawn(H));
+  CHECK(hs_isFiber(H, -1));
+  hs_pop(H);
+
+  hs_pushNumber(H, 1);
+  CHECK(!hs_spawn(H));
+  CHECK(hs_isNumber(H, -1));
+  hs_pop(H);
+
+  struct hs_SchedulerStats stats = tick(H);
+  CHECK(stats.tasksRun == 1);
+  CHECK(stats.ready == 1);
+  stats = tick(H);
+  CHECK(stats.tasksFinished == 1);
+  CHECK(stats.ready == 0);
+}
+
+// Sleeps past the end of the clock stay asleep, and ones that can't sleep
+// run again next tick.
+static void testSleeps(struct hs_State* H) {
+  hs_getGlobal(H, "forever");
+  CHECK(hs_spawn(H));
+  hs_getGlobal(H, "longSleep");
+  CHECK(hs_spawn(H));
+  hs_getGlobal(H, "notANumber");
+  CHECK(hs_spawn(H));
+
+  struct hs_SchedulerStats stats = tick(H);
+  CHECK(stats.tasksRun == 3);
+  CHECK(stats.sleeping == 2);
+  CHECK(stats.ready == 1);
+
+  stats = tick(H);
+  CHECK(stats.tasksRun == 1);
+  CHECK(stats.tasksFinished == 1);
+  CHECK(stats.sleeping == 2);
+
+  stats = tick(H);
+  CHECK(stats.tasksRun == 0);
+  CHECK(stats.sleeping == 2);
+}
+
+int main() {
+  struct hs_State* H = hs_newState();
+  CHECK(interpret(H, script) == INTERPRET_OK);
+
+  testSpawnTwice(H);
+  testSleeps(H);
+
+  hs_freeState(H);
+  return finishChecks("scheduler");
+}
@@ -0,0 +1,127 @@
+// Checks how external strings are shared with the host: hs_getString()
+// hands back the host's own chars, and release is called exactly once,
+// either when the string is collected or straight away if the state
+// already had an equal string. Also checks that hs_getString() and
+// hs_getNumber() don't convert, and that oversized lengths are refused.
+
+#include <stdint.h>
+
+#include "check.h"
+#include "hobbyscript.h"
+
+static const char* released[8];
+static int releaseCount = 0;
+
+static void release(const char* chars, size_t length) {
+  (void)length;
+  if (releaseCount < 8) {
+    released[releaseCount] = chars;
+  }
+  releaseCount++;
+}
+
+static void testCollected(struct hs_State* H) {
+  static const char text[] = "an external string";
+  hs_pushExternalString(H, text, sizeof(text) - 1, release);
+  CHECK(releaseCount == 0);
+
+  const char* chars;
+  size_t length;
+  CHECK(hs_getString(H, -1, &chars, &length));
+  CHECK(chars == text);
+  CHECK(length == sizeof(text) - 1);
+  hs_setGlobal(H, "kept");
+
+  collect(H);
+  CHECK(releaseCount == 0);
+
+  // Pushing an equal string finds the external one.
+  hs_pushString(H, text, sizeof(text) - 1);
+  CHECK(hs_getString(H, -1, &chars, NULL));
+  CHECK(chars == text);
+  hs_pop(H);
+
+  hs_pushNil(H);
+  hs_setGlobal(H, "kept");
+  collect(H);
+  CHECK(releaseCount == 1);
+  CHECK(released[0] == text);
+
+  collect(H);
+  CHECK(releaseCount == 1);
+}
+
+static void testInterned(struct hs_State* H) {
+  static const char text[] = "already here";
+  hs_pushString(H, text, sizeof(text) - 1);
+  hs_setGlobal(H, "copy");
+
+  char external[] = "already here";
+  hs_pushExternalString(H, external, sizeof(external) - 1, release);
+  CHECK(releaseCount == 2);
+  CHECK(released[1] == external);
+
+  const char* chars;
+  CHECK(hs_getString(H, -1, &chars, NULL));
+  CHECK(chars != external);
+  CHECK(strcmp(chars, text) == 0);
+  hs_pop(H);
+}
+
+static void testGetters(struct hs_State* H) {
+  double number = 0;
+  const char* chars = NULL;
+
+  hs_pushNumber(H, 2.5);
+  CHECK(hs_getNumber(H, -1, &number));
+  CHECK(number == 2.5);
+  CHECK(!hs_getString(H, -1, &chars, NULL));
+  CHECK(chars == NULL);
+  hs_pop(H);
+
+  hs_pushString(H, "3", 1);
+  number = 0;
+  CHECK(!hs_getNumber(H, -1, &number));
+  CHECK(number == 0);
+  hs_pop(H);
+
+  CHECK(!hs_getNumber(H, 100, &number));
+  CHECK(!hs_getString(H, -100, &chars, NULL));
+}
+
+static void testTooLong(struct hs_State* H) {
+  static const char text[] = "short really";
+  size_t tooLong = (size_t)INT32_MAX + 1;
+
+  hs_pushExternalString(H, text, tooLong, release);
+  CHECK(releaseCount == 3);
+  CHECK(released[2] == text);
+  CHECK(!hs_isString(H, -1));
+  hs_pop(H);
+
+  hs_pushString(H, text, tooLong);
+  CHECK(!hs_isString(H, -1));
+  hs_pop(H);
+  hs_pushStringHashed(H, text, tooLong, 0);
+  CHECK(!hs_isString(H, -1));
+  hs_pop(H);
+}
+
+int main() {
+  struct hs_State* H = hs_newState();
+
+  testCollected(H);
+  testInterned(H);
+  testGetters(H);
+  testTooLong(H);
+
+  // Freeing the state releases what's still alive.
+  static const char last[] = "released with the state";
+  hs_pushExternalString(H, last, sizeof(last) - 1, release);
+  hs_setGlobal(H, "last");
+  hs_freeState(H);
+  CHECK(releaseCount == 4);
+  CHECK(released[3] == last);
+
+  return finishChecks("strings");
+}
@@ -0,0 +1,165 @@
+// Exercises host userdata: methods called from scripts with the receiver at
+// index 0, a trace hook keeping a payload it points to alive, finalizers run
+// by the collector and by hs_freeState(), and type checks in
+// hs_toUserdata().
+
+#include "check.h"
+#include "hobbyscript.h"
+#include "vm.h"
+
+#define MAX_NODES 16
+
+struct Vec {
+  double x, y;
+};
+
+struct Node {
+  int id;
+  struct Node* next; // Another node's payload, kept alive by trace.
+};
+
+static const struct hs_UserdataType vecType;
+static const struct hs_UserdataType nodeType;
+
+static bool finalized[MAX_NODES];
+static int finalizeCount = 0;
+
+static void vec_sum(struct hs_State* H, int argCount) {
+  (void)argCount;
+  struct Vec* v = hs_toUserdata(H, 0, &vecType);
+  hs_pushNumber(H, v->x + v->y);
+}
+
+static void vec_scale(struct hs_State* H, int argCount) {
+  (void)argCount;
+  struct Vec* v = hs_toUserdata(H, 0, &vecType);
+  double k = hs_toNumber(H, 1);
+  v->x *= k;
+  v->y *= k;
+  hs_push(H, 0);
+}
+
+static const struct hs_FuncInfo vecMethods[] = {
+  {vec_sum, "sum", 0},
+  {vec_scale, "scale", 1},
+  {NULL, NULL, 0},
+};
+
+static const struct hs_UserdataType vecType = {"Vec", NULL, NULL, vecMethods};
+
+static void node_trace(struct hs_State* H, void* data) {
+  hs_markUserdata(H, ((struct Node*)data)->next);
+}
+
+static void node_finalize(void* data) {
+  struct Node* node = data;
+  finalized[node->id] = true;
+  finalizeCount++;
+}
+
+static const struct hs_UserdataType nodeType = {
+  "Node", node_trace, node_finalize, NULL,
+};
+
+static const char* script =
+  "global func sumOf(v) { return v.sum(); }\n"
+  "global func scaled(v) { return v.scale(3).sum(); }\n"
+  "global func missing(v) { return v.length(); }\n";
+
+static struct Node* newNode(struct hs_State* H, int id) {
+  struct Node* node = hs_newUserdata(H, &nodeType, sizeof(struct Node));
+  CHECK(node->next == NULL);
+  node->id = id;
+  return node;
+}
+
+static void testMethods(struct hs_State* H) {
+  struct Vec* v = hs_newUserdata(H, &vecType, sizeof(struct Vec));
+  CHECK(v->x == 0 && v->y == 0);
+  v->x = 1;
+  v->y = 2;
+  hs_setGlobal(H, "v");
+
+  hs_getGlobal(H, "sumOf");
+  hs_getGlobal(H, "v");
+  CHECK(hs_pcall(H, 1, 1) == HS_OK);
+  CHECK(hs_toNumber(H, -1) == 3);
+  hs_pop(H);
+
+  hs_getGlobal(H, "scaled");
+  hs_getGlobal(H, "v");
+  CHECK(hs_pcall(H, 1, 1) == HS_OK);
+  CHECK(hs_toNumber(H, -1) == 9);
+  CHECK(v->x == 3 && v->y == 6);
+  hs_pop(H);
+
+  hs_getGlobal(H, "missing");
+  hs_getGlobal(H, "v");
+  CHECK(hs_pcall(H, 1, 1) == HS_RUNTIME_ERROR);
+  CHECK(isString(H, -1, "Vec does not contain method 'length'."));
+  hs_pop(H);
+}
+
+static void testTypes(struct hs_State* H) {
+  hs_getGlobal(H, "v");
+  CHECK(hs_toUserdata(H, -1, &vecType) != NULL);
+  CHECK(hs_toUserdata(H, -1, &nodeType) == NULL);
+  hs_pop(H);
+
+  hs_pushNumber(H, 1);
+  CHECK(hs_toUserdata(H, -1, &vecType) == NULL);
+  hs_pop(H);
+  hs_pushString(H, "Vec", 3);
+  CHECK(hs_toUserdata(H, -1, &vecType) == NULL);
+  hs_pop(H);
+}
+
+static void testCollection(struct hs_State* H) {
+  // Only the first node is reachable from the script; the second only
+  // through the first's payload.
+  struct Node* first = newNode(H, 1);
+  hs_setGlobal(H, "first");
+  struct Node* second = newNode(H, 2);
+  first->next = second;
+  hs_pop(H);
+
+  // And the third not at all.
+  newNode(H, 3);
+  hs_pop(H);
+
+  collect(H);
+  CHECK(!finalized[1]);
+  CHECK(!finalized[2]);
+  CHECK(finalized[3]);
+  CHECK(second->id == 2);
+
+  // Pushing a payload gives back the same userdata.
+  hs_pushUserdata(H, second);
+  CHECK(hs_toUserdata(H, -1, &nodeType) == second);
+  hs_pop(H);
+
+  first->next = NULL;
+  collect(H);
+  CHECK(!finalized[1]);
+  CHECK(finalized[2]);
+  CHECK(finalizeCount == 2);
+}
+
+int main() {
+  struct hs_State* H = hs_newState();
+  CHECK(interpret(H, script) == INTERPRET_OK);
+
+  testMethods(H);
+  testTypes(H);
+  testCollection(H);
+
+  // The rest are finalized along with the state.
+  newNode(H, 4);
+  hs_pop(H);
+  hs_freeState(H);
+  CHECK(finalized[1]);
+  CHECK(finalized[4]);
+  CHECK(finalizeCount == 4);
+
+  return finishChecks("userdata");
+}
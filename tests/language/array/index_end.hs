@@ -0,0 +1,2 @@
+var arr = [1, 2, 3];
+print(arr[3]); // expect runtime error: Index out of bounds. Array size is 3, but tried accessing 3
@@ -0,0 +1,9 @@
+var arr = [1, 3];
+arr.insert(1, 2);
+arr.insert(0, 0);
+arr.insert(4, 4);
+print(arr[0]); // expect: 0
+print(arr[1]); // expect: 1
+print(arr[2]); // expect: 2
+print(arr[3]); // expect: 3
+print(arr[4]); // expect: 4
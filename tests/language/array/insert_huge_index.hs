@@ -0,0 +1,2 @@
+var arr = [1, 2];
+arr.insert(100000000000000000000, 0); // expect runtime error: Index 1e+20 is out of bounds.
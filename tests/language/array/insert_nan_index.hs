@@ -0,0 +1,2 @@
+var arr = [1, 2];
+arr.insert(0 / 0, 3); // expect runtime error: Expected an integer for the index.
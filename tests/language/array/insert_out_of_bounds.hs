@@ -0,0 +1,2 @@
+var arr = [1, 2];
+arr.insert(3, 0); // expect runtime error: Index 3 is out of bounds.
@@ -0,0 +1,4 @@
+var arr = [1, 2, 3];
+print(arr.pop()); // expect: 3
+print(arr.len()); // expect: 2
+print([].pop()); // expect: nil
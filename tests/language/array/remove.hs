@@ -0,0 +1,8 @@
+var arr = [1, 2, 3, 4, 5];
+print(arr.removeAt(1)); // expect: 2
+print(arr[1]); // expect: 3
+print(arr.len()); // expect: 4
+
+print(arr.swapRemove(0)); // expect: 1
+print(arr[0]); // expect: 5
+print(arr.len()); // expect: 3
@@ -0,0 +1,2 @@
+var arr = [1, 2];
+arr.removeAt(0.5); // expect runtime error: Expected an integer for the index.
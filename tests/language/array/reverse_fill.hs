@@ -0,0 +1,13 @@
+var arr = [1, 2, 3, 4];
+arr.reverse();
+print(arr[0]); // expect: 4
+print(arr[3]); // expect: 1
+
+arr.fill(0);
+print(arr[0]); // expect: 0
+print(arr[3]); // expect: 0
+
+arr.clear();
+print(arr.len()); // expect: 0
+arr.reserve(100);
+print(arr.len()); // expect: 0
@@ -0,0 +1,9 @@
+var arr = ["a", "b", "c"];
+print(arr.indexOf("b")); // expect: 1
+print(arr.indexOf("d")); // expect: -1
+print(arr.contains("c")); // expect: true
+print(arr.contains(nil)); // expect: false
+
+var sorted = [1, 3, 5, 7, 9];
+print(sorted.binarySearch(7)); // expect: 3
+print(sorted.binarySearch(4)); // expect: -1
@@ -0,0 +1,10 @@
+var arr = [1, 2, 3, 4, 5];
+var part = arr.slice(1, 4);
+print(part.len()); // expect: 3
+print(part[0]); // expect: 2
+print(part[2]); // expect: 4
+print(arr.slice(3, 1).len()); // expect: 0
+
+var both = [1, 2].concat([3]);
+print(both.len()); // expect: 3
+print(both[2]); // expect: 3
@@ -0,0 +1,2 @@
+var arr = [1, 2, 3];
+arr.slice(1, 1 / 0); // expect runtime error: Expected an integer for the index.
@@ -0,0 +1,25 @@
+var arr = [];
+var i = 0;
+while (i < 100) {
+  arr.push((i * 37) % 100);
+  i += 1;
+}
+
+arr.sort();
+var ok = true;
+i = 0;
+while (i < 100) {
+  ok = ok && arr[i] == i;
+  i += 1;
+}
+print(ok); // expect: true
+
+arr.sort(func(a, b) => a > b);
+print(arr[0]); // expect: 99
+print(arr[99]); // expect: 0
+print(arr.binarySearch(42, func(a, b) => a > b)); // expect: 57
+
+var words = ["pear", "apple", "fig"];
+words.sort();
+print(words[0]); // expect: apple
+print(words[2]); // expect: pear
@@ -0,0 +1,2 @@
+var arr = [1, "a"];
+arr.sort(); // expect runtime error: Can only compare numbers or strings without a comparator.
@@ -0,0 +1,2 @@
+var view = [1, 2, 3].view(0, 2);
+print(view[2]); // expect runtime error: Index out of bounds. Array size is 2, but tried accessing 2
@@ -0,0 +1,29 @@
+var arr = [9, 5, 7, 1, 3, 0];
+var view = arr.view(0, 5);
+view.sort();
+print(arr[0]); // expect: 1
+print(arr[4]); // expect: 9
+print(arr[5]); // expect: 0
+
+print(view.indexOf(7)); // expect: 3
+print(view.contains(0)); // expect: false
+print(view.binarySearch(5)); // expect: 2
+
+arr.view(1, 3).reverse();
+print(arr[1]); // expect: 5
+print(arr[2]); // expect: 3
+
+arr.view(4, 6).fill(8);
+print(arr[4]); // expect: 8
+print(arr[5]); // expect: 8
+
+var copy = arr.view(1, 3).slice(0, 2);
+copy[0] = 100;
+print(arr[1]); // expect: 5
+print(view.concat(arr.view(5, 6)).len()); // expect: 6
+
+var sum = 0;
+for (i, x in arr.view(0, 3)) {
+  sum = sum + i * x;
+}
+print(sum); // expect: 11
@@ -0,0 +1,8 @@
+var arr = [1, 2, 3, 4];
+var view = arr.view(1, 4);
+arr.pop();
+arr.pop();
+print(view.len()); // expect: 1
+print(view[0]); // expect: 2
+arr.clear();
+print(view.len()); // expect: 0
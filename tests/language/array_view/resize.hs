@@ -0,0 +1,2 @@
+var view = [1, 2, 3].view(0, 2);
+view.push(4); // expect runtime error: Cannot resize an array view.
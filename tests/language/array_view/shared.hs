@@ -0,0 +1,14 @@
+var arr = [1, 2, 3, 4, 5];
+var view = arr.view(1, 4);
+print(view); // expect: <array view>
+print(view.len()); // expect: 3
+print(view[0]); // expect: 2
+
+view[0] = 20;
+print(arr[1]); // expect: 20
+arr[3] = 40;
+print(view[2]); // expect: 40
+
+var inner = view.view(1, 3);
+print(inner[0]); // expect: 3
+print(inner[1]); // expect: 40
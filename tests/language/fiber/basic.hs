@@ -0,0 +1,16 @@
+var f = fiber(func(first) {
+  print(first);
+  var second = yield 1;
+  print(second);
+  yield;
+  return "done";
+});
+
+print(f); // expect: <fiber>
+print(resume(f, "a")); // expect: a
+// expect: 1
+print(resume(f, "b")); // expect: b
+// expect: nil
+print(f.isDone()); // expect: false
+print(resume(f)); // expect: done
+print(f.isDone()); // expect: true
@@ -0,0 +1,17 @@
+// Locals captured inside a fiber stay shared while it is suspended, and
+// survive it finishing.
+var get;
+var f = fiber(func() {
+  var count = 0;
+  get = func() { return count; };
+  while (true) {
+    count += 1;
+    yield count;
+  }
+});
+
+resume(f);
+resume(f);
+print(get()); // expect: 2
+resume(f);
+print(get()); // expect: 3
@@ -0,0 +1,11 @@
+// Starting a fiber allocates its stack, which can collect garbage while the
+// fiber and the value it's resumed with are being handed over.
+var i = 0;
+var total = 0;
+while (i < 20000) {
+  var junk = [i, i, i, i, i, i, i, i];
+  total += resume(fiber(func(x) { return x; }), 1);
+  total += resume(fiber(func() { return 1; }));
+  i += 1;
+}
+print(total); // expect: 40000
@@ -0,0 +1,34 @@
+// A fiber's stack grows as its calls get deeper, and its frames, locals and
+// captured variables move along with it.
+func descend(n, log) {
+  var local = n;
+  var read = func() { return local; };
+  if (n == 0) {
+    yield read;
+    return 0;
+  }
+  var below = descend(n - 1, log);
+  log.push(read());
+  return below + local;
+}
+
+var log = [];
+var f = fiber(func() { return descend(50, log); });
+var read = resume(f);
+print(read()); // expect: 0
+print(resume(f)); // expect: 1275
+print(log.len()); // expect: 50
+print(log[49]); // expect: 50
+
+// Natives that call back into scripts see their arguments where they moved.
+func depth(n) {
+  if (n == 0) return 0;
+  return depth(n - 1) + 1;
+}
+var sorted = resume(fiber(func() {
+  var values = [3, 1, 2];
+  values.sort(func(a, b) { return depth(40) + a < depth(40) + b; });
+  return values;
+}));
+print(sorted[0]); // expect: 1
+print(sorted[2]); // expect: 3
@@ -0,0 +1,6 @@
+var f = fiber(func() {
+  yield 1;
+  nil.x; // expect runtime error: Invalid target for the dot operator.
+});
+resume(f);
+resume(f);
@@ -0,0 +1,20 @@
+func range(n) {
+  return fiber(func() {
+    var i = 0;
+    while (i < n) {
+      yield i;
+      i += 1;
+    }
+  });
+}
+
+var gen = range(3);
+var total = 0;
+while (true) {
+  var value = resume(gen);
+  if (gen.isDone()) {
+    break;
+  }
+  total += value;
+}
+print(total); // expect: 3
@@ -0,0 +1,16 @@
+// Fibers can resume other fibers, and yield back to whichever resumed them.
+var inner = fiber(func() {
+  yield "inner 1";
+  yield "inner 2";
+});
+
+var outer = fiber(func() {
+  print(resume(inner));
+  yield "outer";
+  print(resume(inner));
+});
+
+print(resume(outer)); // expect: inner 1
+// expect: outer
+resume(outer); // expect: inner 2
+print(outer.isDone()); // expect: true
@@ -0,0 +1,3 @@
+var f = fiber(func() {});
+resume(f);
+resume(f); // expect runtime error: Cannot resume a finished fiber.
@@ -0,0 +1,5 @@
+var f;
+f = fiber(func() {
+  resume(f); // expect runtime error: Cannot resume a running fiber.
+});
+resume(f);
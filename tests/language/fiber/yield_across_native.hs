@@ -0,0 +1,8 @@
+var f = fiber(func() {
+  var values = [2, 1];
+  values.sort(func(a, b) {
+    yield; // expect runtime error: Cannot yield across a native call.
+    return a < b;
+  });
+});
+resume(f);
@@ -0,0 +1,4 @@
+func f() {
+  yield 1; // expect runtime error: Cannot yield from the main fiber.
+}
+f();
@@ -5,4 +5,4 @@ struct Foo {
 var foo = Foo {};
 foo.bar = "not function";
 
-foo.bar(); // expect runtime error: 'string' is not callable
+foo.bar(); // expect runtime error: Can only call functions.
@@ -1,4 +1,4 @@
 struct Foo {}
 var foo = Foo {};
 
-foo.bar; // expect runtime error: Undefined method 'bar'
+foo.bar; // expect runtime error: Undefined property 'bar'.
@@ -0,0 +1,23 @@
+for (x in [1, 2, 3]) {
+  print(x);
+}
+// expect: 1
+// expect: 2
+// expect: 3
+
+for (i, x in ["a", "b"]) {
+  print(i);
+  print(x);
+}
+// expect: 0
+// expect: a
+// expect: 1
+// expect: b
+
+for (x in []) {
+  print("never");
+}
+
+for (x in f64Array([0.5, 1.5])) print(x);
+// expect: 0.5
+// expect: 1.5
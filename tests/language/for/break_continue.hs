@@ -0,0 +1,23 @@
+for (x in [1, 2, 3, 4, 5]) {
+  if (x == 2) {
+    continue;
+  }
+  if (x == 4) {
+    break;
+  }
+  var doubled = x * 2;
+  print(doubled);
+}
+// expect: 2
+// expect: 6
+
+for (x in [1, 2]) : outer {
+  for (y in [10, 20]) {
+    if (y == 20) {
+      continue outer;
+    }
+    print(x + y);
+  }
+}
+// expect: 11
+// expect: 12
@@ -0,0 +1,40 @@
+var fns = [];
+for (x in [1, 2, 3]) {
+  var captured = x;
+  fns.push(func() => captured);
+}
+
+for (f in fns) {
+  print(f());
+}
+// expect: 1
+// expect: 2
+// expect: 3
+
+var direct = [];
+for (x in [1, 2, 3]) {
+  direct.push(func() => x);
+}
+print(direct[0]()); // expect: 1
+print(direct[1]()); // expect: 2
+print(direct[2]()); // expect: 3
+
+var pairs = [];
+for (i, x in ["a", "b"]) {
+  if (i == 0) {
+    pairs.push(func() => toString(i) .. x);
+    continue;
+  }
+  pairs.push(func() => toString(i) .. x);
+}
+print(pairs[0]()); // expect: 0a
+print(pairs[1]()); // expect: 1b
+
+// Assigning to the variable inside the body only changes that iteration's.
+var counters = [];
+for (x in [10, 20]) {
+  counters.push(func() { x += 1; return x; });
+}
+print(counters[0]()); // expect: 11
+print(counters[0]()); // expect: 12
+print(counters[1]()); // expect: 21
@@ -0,0 +1,20 @@
+enum Color {
+  Red,
+  Green,
+  Blue,
+}
+
+var sum = 0;
+var count = 0;
+for (value in Color) {
+  sum += value;
+  count += 1;
+}
+print(count); // expect: 3
+print(sum); // expect: 3
+
+for (name, value in Color) {
+  if (value == 2) {
+    print(name); // expect: Blue
+  }
+}
@@ -0,0 +1,9 @@
+func sum(arr) {
+  var total = 0;
+  for (x in arr) {
+    total += x;
+  }
+  return total;
+}
+
+print(sum([1, 2, 3, 4])); // expect: 10
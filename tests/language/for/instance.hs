@@ -0,0 +1,13 @@
+struct Point {
+  var x = 3;
+  var y = 4;
+}
+
+var total = 0;
+var names = "";
+for (name, value in Point {}) {
+  total += value;
+  names = names .. name;
+}
+print(total); // expect: 7
+print(names == "xy" || names == "yx"); // expect: true
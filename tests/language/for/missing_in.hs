@@ -0,0 +1 @@
+for (x of [1]) print(x); // expect error
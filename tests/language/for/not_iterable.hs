@@ -0,0 +1,3 @@
+for (x in 3) { // expect runtime error: Can only iterate over arrays, instances and enums.
+  print(x);
+}
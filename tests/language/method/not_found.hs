@@ -1,3 +1,3 @@
 struct Foo {}
 
-Foo {}.unknown(); // expect runtime error: Undefined method 'unknown'
+Foo {}.unknown(); // expect runtime error: Undefined property 'unknown'.
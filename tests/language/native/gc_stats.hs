@@ -0,0 +1,17 @@
+var before = gcStats();
+print(before.collections >= 0); // expect: true
+print(before.bytesAllocated > 0); // expect: true
+
+var i = 0;
+while (i < 50000) {
+  var garbage = [i, i, i, i];
+  i = i + 1;
+}
+
+var after = gcStats();
+print(after.collections > before.collections); // expect: true
+print(after.objectsFreed > 0); // expect: true
+print(after.bytesBefore > after.bytesAfter); // expect: true
+print(after.nextGc > 0); // expect: true
+print(after.pauseMs >= after.markMs); // expect: true
+print(after.totalPauseMs >= after.pauseMs); // expect: true
@@ -0,0 +1,11 @@
+print(sqrt(16)); // expect: 4
+print(floor(2.5)); // expect: 2
+print(ceil(2.5)); // expect: 3
+print(abs(-3)); // expect: 3
+print(min(4, 2)); // expect: 2
+print(max(4, 2)); // expect: 4
+print(atan2(0, 1)); // expect: 0
+print(sin(0) + cos(0)); // expect: 1
+
+var f = sqrt;
+print(f(9)); // expect: 3
@@ -0,0 +1 @@
+sqrt(1, 2); // expect runtime error: Expected 1 arguments, but got 2.
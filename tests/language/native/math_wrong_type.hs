@@ -0,0 +1 @@
+max(1, "2"); // expect runtime error: Expected a number for argument 2.
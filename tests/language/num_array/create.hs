@@ -0,0 +1,17 @@
+var a = f64Array(4);
+print(a); // expect: <f64array>
+print(a.len()); // expect: 4
+print(a[3]); // expect: 0
+
+var b = f32Array([1, 2, 3]);
+print(b); // expect: <f32array>
+print(b[2]); // expect: 3
+
+var c = i32Array([1.9, -2.5]);
+print(c); // expect: <i32array>
+print(c[0]); // expect: 1
+print(c[1]); // expect: -2
+
+var d = i32Array([10000000000, -10000000000]);
+print(d[0]); // expect: 2147483647
+print(d[1]); // expect: -2147483648
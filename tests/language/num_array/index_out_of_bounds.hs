@@ -0,0 +1,2 @@
+var a = f64Array(2);
+a[2]; // expect runtime error: Index out of bounds. Array size is 2, but tried accessing 2
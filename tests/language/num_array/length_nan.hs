@@ -0,0 +1 @@
+i32Array(0 / 0); // expect runtime error: Number array length must be a number, not NaN.
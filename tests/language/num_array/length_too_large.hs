@@ -0,0 +1 @@
+f64Array(100000000000000000000); // expect runtime error: Out of memory.
@@ -0,0 +1,30 @@
+// Odd lengths so the SIMD kernels have to handle a tail.
+var a = f64Array([1, 2, 3, 4, 5, 6, 7]);
+var b = f64Array([7, 6, 5, 4, 3, 2, 1]);
+
+print(a.sum()); // expect: 28
+print(a.dot(b)); // expect: 84
+print(a.min()); // expect: 1
+print(a.max()); // expect: 7
+
+a.add(b);
+print(a[0]); // expect: 8
+print(a[6]); // expect: 8
+
+a.scale(0.5);
+print(a[3]); // expect: 4
+
+a.clamp(0, 3);
+print(a.max()); // expect: 3
+
+var c = f64Array(7);
+c.lerp(b, 0.5);
+print(c[0]); // expect: 3.5
+print(c[6]); // expect: 0.5
+
+var d = i32Array([5, -3, 9]);
+print(d.sum()); // expect: 11
+print(d.min()); // expect: -3
+print(d.max()); // expect: 9
+
+print(f64Array(0).min()); // expect: nil
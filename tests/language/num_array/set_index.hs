@@ -0,0 +1,16 @@
+var a = f64Array(3);
+a[1] = 2.5;
+print(a[0]); // expect: 0
+print(a[1]); // expect: 2.5
+
+var b = i32Array(2);
+print(b[0] = 7.8); // expect: 7.8
+print(b[0]); // expect: 7
+
+// Numbers past the s32 range saturate, and NaN stores 0.
+b[0] = 10000000000;
+b[1] = -10000000000;
+print(b[0]); // expect: 2147483647
+print(b[1]); // expect: -2147483648
+b[0] = 0 / 0;
+print(b[0]); // expect: 0
@@ -0,0 +1,18 @@
+// Tasks take turns: each runs once per tick, in the order they were queued.
+spawn(func() {
+  print("a1");
+  yield;
+  print("a2");
+});
+spawn(func() {
+  print("b1");
+  yield;
+  print("b2");
+});
+print("spawned");
+
+// expect: spawned
+// expect: a1
+// expect: b1
+// expect: a2
+// expect: b2
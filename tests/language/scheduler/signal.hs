@@ -0,0 +1,14 @@
+spawn(func() {
+  print("waiting");
+  yield "door";
+  print("opened");
+});
+spawn(func() {
+  yield;
+  print("knock");
+  signal("door");
+});
+
+// expect: waiting
+// expect: knock
+// expect: opened
@@ -0,0 +1,11 @@
+spawn(func() {
+  yield 0.03;
+  print("slow");
+});
+spawn(func() {
+  yield 0.01;
+  print("fast");
+});
+
+// expect: fast
+// expect: slow
@@ -0,0 +1,3 @@
+var f = fiber(func() {});
+resume(f);
+spawn(f); // expect runtime error: Cannot spawn a finished fiber.
@@ -0,0 +1,4 @@
+var f = fiber(func() {
+  spawn(f); // expect runtime error: Cannot spawn a running fiber.
+});
+resume(f);
@@ -0,0 +1,3 @@
+var f = fiber(func() { yield; });
+spawn(f);
+spawn(f); // expect runtime error: Cannot spawn a fiber that is already a task.
@@ -0,0 +1,12 @@
+// A failing task doesn't stop the others.
+spawn(func() {
+  yield;
+  nil.x; // expect handled runtime error: Invalid target for the dot operator.
+});
+spawn(func() {
+  yield;
+  yield;
+  print("still running");
+});
+
+// expect: still running
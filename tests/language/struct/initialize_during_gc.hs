@@ -0,0 +1,28 @@
+// Builds enough instances with default fields for collections to run while
+// they're being initialized.
+struct Node {
+  var left;
+  var right;
+}
+
+func tree(depth) {
+  if (depth == 0) {
+    return Node {};
+  }
+  return Node { .left = tree(depth - 1), .right = tree(depth - 1) };
+}
+
+func count(node) {
+  if (node.left == nil) {
+    return 1;
+  }
+  return count(node.left) + count(node.right);
+}
+
+var kept = tree(14);
+var i = 0;
+while (i < 10) {
+  tree(8);
+  i += 1;
+}
+print(count(kept)); // expect: 16384
@@ -1,3 +1,3 @@
 global var a = "1";
-global var a;
-print(a); // expect runtime error: Redefinition of 'a'.
+global var a; // expect runtime error: Redefinition of 'a'.
+print(a);
@@ -0,0 +1,40 @@
+// A computed element after many literal ones runs on top of them once
+// they're spilled, so its own temporaries count from there.
+func f() {
+  var x = 1;
+  return [1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, [x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x, x]];
+}
+
+func deep(n) {
+  var l0 = 0; var l1 = 1; var l2 = 2; var l3 = 3; var l4 = 4; var l5 = 5; var l6 = 6; var l7 = 7; var l8 = 8; var l9 = 9;
+  var l10 = 10; var l11 = 11; var l12 = 12; var l13 = 13; var l14 = 14; var l15 = 15; var l16 = 16; var l17 = 17; var l18 = 18; var l19 = 19;
+  var l20 = 20; var l21 = 21; var l22 = 22; var l23 = 23; var l24 = 24; var l25 = 25; var l26 = 26; var l27 = 27; var l28 = 28; var l29 = 29;
+  var l30 = 30; var l31 = 31; var l32 = 32; var l33 = 33; var l34 = 34; var l35 = 35; var l36 = 36; var l37 = 37; var l38 = 38; var l39 = 39;
+  var l40 = 40; var l41 = 41; var l42 = 42; var l43 = 43; var l44 = 44; var l45 = 45; var l46 = 46; var l47 = 47; var l48 = 48; var l49 = 49;
+  var l50 = 50; var l51 = 51; var l52 = 52; var l53 = 53; var l54 = 54; var l55 = 55; var l56 = 56; var l57 = 57; var l58 = 58; var l59 = 59;
+  var l60 = 60; var l61 = 61; var l62 = 62; var l63 = 63; var l64 = 64; var l65 = 65; var l66 = 66; var l67 = 67; var l68 = 68; var l69 = 69;
+  var l70 = 70; var l71 = 71; var l72 = 72; var l73 = 73; var l74 = 74; var l75 = 75; var l76 = 76; var l77 = 77; var l78 = 78; var l79 = 79;
+  var l80 = 80; var l81 = 81; var l82 = 82; var l83 = 83; var l84 = 84; var l85 = 85; var l86 = 86; var l87 = 87; var l88 = 88; var l89 = 89;
+  var l90 = 90; var l91 = 91; var l92 = 92; var l93 = 93; var l94 = 94; var l95 = 95; var l96 = 96; var l97 = 97; var l98 = 98; var l99 = 99;
+  var l100 = 100; var l101 = 101; var l102 = 102; var l103 = 103; var l104 = 104; var l105 = 105; var l106 = 106; var l107 = 107; var l108 = 108; var l109 = 109;
+  var l110 = 110; var l111 = 111; var l112 = 112; var l113 = 113; var l114 = 114; var l115 = 115; var l116 = 116; var l117 = 117; var l118 = 118; var l119 = 119;
+  var l120 = 120; var l121 = 121; var l122 = 122; var l123 = 123; var l124 = 124; var l125 = 125; var l126 = 126; var l127 = 127; var l128 = 128; var l129 = 129;
+  var l130 = 130; var l131 = 131; var l132 = 132; var l133 = 133; var l134 = 134; var l135 = 135; var l136 = 136; var l137 = 137; var l138 = 138; var l139 = 139;
+  var l140 = 140; var l141 = 141; var l142 = 142; var l143 = 143; var l144 = 144; var l145 = 145; var l146 = 146; var l147 = 147; var l148 = 148; var l149 = 149;
+  var l150 = 150; var l151 = 151; var l152 = 152; var l153 = 153; var l154 = 154; var l155 = 155; var l156 = 156; var l157 = 157; var l158 = 158; var l159 = 159;
+  var l160 = 160; var l161 = 161; var l162 = 162; var l163 = 163; var l164 = 164; var l165 = 165; var l166 = 166; var l167 = 167; var l168 = 168; var l169 = 169;
+  var l170 = 170; var l171 = 171; var l172 = 172; var l173 = 173; var l174 = 174; var l175 = 175; var l176 = 176; var l177 = 177; var l178 = 178; var l179 = 179;
+  var l180 = 180; var l181 = 181; var l182 = 182; var l183 = 183; var l184 = 184; var l185 = 185; var l186 = 186; var l187 = 187; var l188 = 188; var l189 = 189;
+  var l190 = 190; var l191 = 191; var l192 = 192; var l193 = 193; var l194 = 194; var l195 = 195; var l196 = 196; var l197 = 197; var l198 = 198; var l199 = 199;
+  var l200 = 200; var l201 = 201; var l202 = 202; var l203 = 203; var l204 = 204; var l205 = 205; var l206 = 206; var l207 = 207; var l208 = 208; var l209 = 209;
+  var l210 = 210; var l211 = 211; var l212 = 212; var l213 = 213; var l214 = 214; var l215 = 215; var l216 = 216; var l217 = 217; var l218 = 218; var l219 = 219;
+  var l220 = 220; var l221 = 221; var l222 = 222; var l223 = 223; var l224 = 224; var l225 = 225; var l226 = 226; var l227 = 227; var l228 = 228; var l229 = 229;
+  var l230 = 230; var l231 = 231; var l232 = 232; var l233 = 233; var l234 = 234; var l235 = 235; var l236 = 236; var l237 = 237; var l238 = 238; var l239 = 239;
+  var l240 = 240; var l241 = 241; var l242 = 242; var l243 = 243; var l244 = 244; var l245 = 245; var l246 = 246; var l247 = 247; var l248 = 248; var l249 = 249;
+  if (n == 0) return f(); // expect runtime error: Stack overflow.
+  return deep(n - 1);
+}
+
+print(f().len()); // expect: 1000
+var fb = fiber(func() { return deep(57); });
+resume(fb);
@@ -0,0 +1,110 @@
+// A function with many locals and a deeply nested expression runs inside a
+// fiber, whose stack is smaller than the main one.
+
+func wide() {
+  var v1 = 1; var v2 = 1; var v3 = 1; var v4 = 1; var v5 = 1; var v6 = 1; var v7 = 1; var v8 = 1; var v9 = 1; var v10 = 1;
+  var v11 = 1; var v12 = 1; var v13 = 1; var v14 = 1; var v15 = 1; var v16 = 1; var v17 = 1; var v18 = 1; var v19 = 1; var v20 = 1;
+  var v21 = 1; var v22 = 1; var v23 = 1; var v24 = 1; var v25 = 1; var v26 = 1; var v27 = 1; var v28 = 1; var v29 = 1; var v30 = 1;
+  var v31 = 1; var v32 = 1; var v33 = 1; var v34 = 1; var v35 = 1; var v36 = 1; var v37 = 1; var v38 = 1; var v39 = 1; var v40 = 1;
+  var v41 = 1; var v42 = 1; var v43 = 1; var v44 = 1; var v45 = 1; var v46 = 1; var v47 = 1; var v48 = 1; var v49 = 1; var v50 = 1;
+  var v51 = 1; var v52 = 1; var v53 = 1; var v54 = 1; var v55 = 1; var v56 = 1; var v57 = 1; var v58 = 1; var v59 = 1; var v60 = 1;
+  var v61 = 1; var v62 = 1; var v63 = 1; var v64 = 1; var v65 = 1; var v66 = 1; var v67 = 1; var v68 = 1; var v69 = 1; var v70 = 1;
+  var v71 = 1; var v72 = 1; var v73 = 1; var v74 = 1; var v75 = 1; var v76 = 1; var v77 = 1; var v78 = 1; var v79 = 1; var v80 = 1;
+  var v81 = 1; var v82 = 1; var v83 = 1; var v84 = 1; var v85 = 1; var v86 = 1; var v87 = 1; var v88 = 1; var v89 = 1; var v90 = 1;
+  var v91 = 1; var v92 = 1; var v93 = 1; var v94 = 1; var v95 = 1; var v96 = 1; var v97 = 1; var v98 = 1; var v99 = 1; var v100 = 1;
+  var v101 = 1; var v102 = 1; var v103 = 1; var v104 = 1; var v105 = 1; var v106 = 1; var v107 = 1; var v108 = 1; var v109 = 1; var v110 = 1;
+  var v111 = 1; var v112 = 1; var v113 = 1; var v114 = 1; var v115 = 1; var v116 = 1; var v117 = 1; var v118 = 1; var v119 = 1; var v120 = 1;
+  var v121 = 1; var v122 = 1; var v123 = 1; var v124 = 1; var v125 = 1; var v126 = 1; var v127 = 1; var v128 = 1; var v129 = 1; var v130 = 1;
+  var v131 = 1; var v132 = 1; var v133 = 1; var v134 = 1; var v135 = 1; var v136 = 1; var v137 = 1; var v138 = 1; var v139 = 1; var v140 = 1;
+  var v141 = 1; var v142 = 1; var v143 = 1; var v144 = 1; var v145 = 1; var v146 = 1; var v147 = 1; var v148 = 1; var v149 = 1; var v150 = 1;
+  var v151 = 1; var v152 = 1; var v153 = 1; var v154 = 1; var v155 = 1; var v156 = 1; var v157 = 1; var v158 = 1; var v159 = 1; var v160 = 1;
+  var v161 = 1; var v162 = 1; var v163 = 1; var v164 = 1; var v165 = 1; var v166 = 1; var v167 = 1; var v168 = 1; var v169 = 1; var v170 = 1;
+  var v171 = 1; var v172 = 1; var v173 = 1; var v174 = 1; var v175 = 1; var v176 = 1; var v177 = 1; var v178 = 1; var v179 = 1; var v180 = 1;
+  var v181 = 1; var v182 = 1; var v183 = 1; var v184 = 1; var v185 = 1; var v186 = 1; var v187 = 1; var v188 = 1; var v189 = 1; var v190 = 1;
+  var v191 = 1; var v192 = 1; var v193 = 1; var v194 = 1; var v195 = 1; var v196 = 1; var v197 = 1; var v198 = 1; var v199 = 1; var v200 = 1;
+  var v201 = 1; var v202 = 1; var v203 = 1; var v204 = 1; var v205 = 1; var v206 = 1; var v207 = 1; var v208 = 1; var v209 = 1; var v210 = 1;
+  var v211 = 1; var v212 = 1; var v213 = 1; var v214 = 1; var v215 = 1; var v216 = 1; var v217 = 1; var v218 = 1; var v219 = 1; var v220 = 1;
+  var v221 = 1; var v222 = 1; var v223 = 1; var v224 = 1; var v225 = 1; var v226 = 1; var v227 = 1; var v228 = 1; var v229 = 1; var v230 = 1;
+  var v231 = 1; var v232 = 1; var v233 = 1; var v234 = 1; var v235 = 1; var v236 = 1; var v237 = 1; var v238 = 1; var v239 = 1; var v240 = 1;
+  var v241 = 1; var v242 = 1; var v243 = 1; var v244 = 1; var v245 = 1; var v246 = 1; var v247 = 1; var v248 = 1; var v249 = 1; var v250 = 1;
+  var v251 = 1; var v252 = 1; var v253 = 1; var v254 = 1; var v255 = 1; var v256 = 1; var v257 = 1; var v258 = 1; var v259 = 1; var v260 = 1;
+  var v261 = 1; var v262 = 1; var v263 = 1; var v264 = 1; var v265 = 1; var v266 = 1; var v267 = 1; var v268 = 1; var v269 = 1; var v270 = 1;
+  var v271 = 1; var v272 = 1; var v273 = 1; var v274 = 1; var v275 = 1; var v276 = 1; var v277 = 1; var v278 = 1; var v279 = 1; var v280 = 1;
+  var v281 = 1; var v282 = 1; var v283 = 1; var v284 = 1; var v285 = 1; var v286 = 1; var v287 = 1; var v288 = 1; var v289 = 1; var v290 = 1;
+  var v291 = 1; var v292 = 1; var v293 = 1; var v294 = 1; var v295 = 1; var v296 = 1; var v297 = 1; var v298 = 1; var v299 = 1; var v300 = 1;
+  var v301 = 1; var v302 = 1; var v303 = 1; var v304 = 1; var v305 = 1; var v306 = 1; var v307 = 1; var v308 = 1; var v309 = 1; var v310 = 1;
+  var v311 = 1; var v312 = 1; var v313 = 1; var v314 = 1; var v315 = 1; var v316 = 1; var v317 = 1; var v318 = 1; var v319 = 1; var v320 = 1;
+  var v321 = 1; var v322 = 1; var v323 = 1; var v324 = 1; var v325 = 1; var v326 = 1; var v327 = 1; var v328 = 1; var v329 = 1; var v330 = 1;
+  var v331 = 1; var v332 = 1; var v333 = 1; var v334 = 1; var v335 = 1; var v336 = 1; var v337 = 1; var v338 = 1; var v339 = 1; var v340 = 1;
+  var v341 = 1; var v342 = 1; var v343 = 1; var v344 = 1; var v345 = 1; var v346 = 1; var v347 = 1; var v348 = 1; var v349 = 1; var v350 = 1;
+  var v351 = 1; var v352 = 1; var v353 = 1; var v354 = 1; var v355 = 1; var v356 = 1; var v357 = 1; var v358 = 1; var v359 = 1; var v360 = 1;
+  var v361 = 1; var v362 = 1; var v363 = 1; var v364 = 1; var v365 = 1; var v366 = 1; var v367 = 1; var v368 = 1; var v369 = 1; var v370 = 1;
+  var v371 = 1; var v372 = 1; var v373 = 1; var v374 = 1; var v375 = 1; var v376 = 1; var v377 = 1; var v378 = 1; var v379 = 1; var v380 = 1;
+  var v381 = 1; var v382 = 1; var v383 = 1; var v384 = 1; var v385 = 1; var v386 = 1; var v387 = 1; var v388 = 1; var v389 = 1; var v390 = 1;
+  var v391 = 1; var v392 = 1; var v393 = 1; var v394 = 1; var v395 = 1; var v396 = 1; var v397 = 1; var v398 = 1; var v399 = 1; var v400 = 1;
+  var v401 = 1; var v402 = 1; var v403 = 1; var v404 = 1; var v405 = 1; var v406 = 1; var v407 = 1; var v408 = 1; var v409 = 1; var v410 = 1;
+  var v411 = 1; var v412 = 1; var v413 = 1; var v414 = 1; var v415 = 1; var v416 = 1; var v417 = 1; var v418 = 1; var v419 = 1; var v420 = 1;
+  var v421 = 1; var v422 = 1; var v423 = 1; var v424 = 1; var v425 = 1; var v426 = 1; var v427 = 1; var v428 = 1; var v429 = 1; var v430 = 1;
+  var v431 = 1; var v432 = 1; var v433 = 1; var v434 = 1; var v435 = 1; var v436 = 1; var v437 = 1; var v438 = 1; var v439 = 1; var v440 = 1;
+  var v441 = 1; var v442 = 1; var v443 = 1; var v444 = 1; var v445 = 1; var v446 = 1; var v447 = 1; var v448 = 1; var v449 = 1; var v450 = 1;
+  var v451 = 1; var v452 = 1; var v453 = 1; var v454 = 1; var v455 = 1; var v456 = 1; var v457 = 1; var v458 = 1; var v459 = 1; var v460 = 1;
+  var v461 = 1; var v462 = 1; var v463 = 1; var v464 = 1; var v465 = 1; var v466 = 1; var v467 = 1; var v468 = 1; var v469 = 1; var v470 = 1;
+  var v471 = 1; var v472 = 1; var v473 = 1; var v474 = 1; var v475 = 1; var v476 = 1; var v477 = 1; var v478 = 1; var v479 = 1; var v480 = 1;
+  var v481 = 1; var v482 = 1; var v483 = 1; var v484 = 1; var v485 = 1; var v486 = 1; var v487 = 1; var v488 = 1; var v489 = 1; var v490 = 1;
+  var v491 = 1; var v492 = 1; var v493 = 1; var v494 = 1; var v495 = 1; var v496 = 1; var v497 = 1; var v498 = 1; var v499 = 1; var v500 = 1;
+  var v501 = 1; var v502 = 1; var v503 = 1; var v504 = 1; var v505 = 1; var v506 = 1; var v507 = 1; var v508 = 1; var v509 = 1; var v510 = 1;
+  var v511 = 1; var v512 = 1; var v513 = 1; var v514 = 1; var v515 = 1; var v516 = 1; var v517 = 1; var v518 = 1; var v519 = 1; var v520 = 1;
+  var v521 = 1; var v522 = 1; var v523 = 1; var v524 = 1; var v525 = 1; var v526 = 1; var v527 = 1; var v528 = 1; var v529 = 1; var v530 = 1;
+  var v531 = 1; var v532 = 1; var v533 = 1; var v534 = 1; var v535 = 1; var v536 = 1; var v537 = 1; var v538 = 1; var v539 = 1; var v540 = 1;
+  var v541 = 1; var v542 = 1; var v543 = 1; var v544 = 1; var v545 = 1; var v546 = 1; var v547 = 1; var v548 = 1; var v549 = 1; var v550 = 1;
+  var v551 = 1; var v552 = 1; var v553 = 1; var v554 = 1; var v555 = 1; var v556 = 1; var v557 = 1; var v558 = 1; var v559 = 1; var v560 = 1;
+  var v561 = 1; var v562 = 1; var v563 = 1; var v564 = 1; var v565 = 1; var v566 = 1; var v567 = 1; var v568 = 1; var v569 = 1; var v570 = 1;
+  var v571 = 1; var v572 = 1; var v573 = 1; var v574 = 1; var v575 = 1; var v576 = 1; var v577 = 1; var v578 = 1; var v579 = 1; var v580 = 1;
+  var v581 = 1; var v582 = 1; var v583 = 1; var v584 = 1; var v585 = 1; var v586 = 1; var v587 = 1; var v588 = 1; var v589 = 1; var v590 = 1;
+  var v591 = 1; var v592 = 1; var v593 = 1; var v594 = 1; var v595 = 1; var v596 = 1; var v597 = 1; var v598 = 1; var v599 = 1; var v600 = 1;
+  var v601 = 1; var v602 = 1; var v603 = 1; var v604 = 1; var v605 = 1; var v606 = 1; var v607 = 1; var v608 = 1; var v609 = 1; var v610 = 1;
+  var v611 = 1; var v612 = 1; var v613 = 1; var v614 = 1; var v615 = 1; var v616 = 1; var v617 = 1; var v618 = 1; var v619 = 1; var v620 = 1;
+  var v621 = 1; var v622 = 1; var v623 = 1; var v624 = 1; var v625 = 1; var v626 = 1; var v627 = 1; var v628 = 1; var v629 = 1; var v630 = 1;
+  var v631 = 1; var v632 = 1; var v633 = 1; var v634 = 1; var v635 = 1; var v636 = 1; var v637 = 1; var v638 = 1; var v639 = 1; var v640 = 1;
+  var v641 = 1; var v642 = 1; var v643 = 1; var v644 = 1; var v645 = 1; var v646 = 1; var v647 = 1; var v648 = 1; var v649 = 1; var v650 = 1;
+  var v651 = 1; var v652 = 1; var v653 = 1; var v654 = 1; var v655 = 1; var v656 = 1; var v657 = 1; var v658 = 1; var v659 = 1; var v660 = 1;
+  var v661 = 1; var v662 = 1; var v663 = 1; var v664 = 1; var v665 = 1; var v666 = 1; var v667 = 1; var v668 = 1; var v669 = 1; var v670 = 1;
+  var v671 = 1; var v672 = 1; var v673 = 1; var v674 = 1; var v675 = 1; var v676 = 1; var v677 = 1; var v678 = 1; var v679 = 1; var v680 = 1;
+  var v681 = 1; var v682 = 1; var v683 = 1; var v684 = 1; var v685 = 1; var v686 = 1; var v687 = 1; var v688 = 1; var v689 = 1; var v690 = 1;
+  var v691 = 1; var v692 = 1; var v693 = 1; var v694 = 1; var v695 = 1; var v696 = 1; var v697 = 1; var v698 = 1; var v699 = 1; var v700 = 1;
+  var v701 = 1; var v702 = 1; var v703 = 1; var v704 = 1; var v705 = 1; var v706 = 1; var v707 = 1; var v708 = 1; var v709 = 1; var v710 = 1;
+  var v711 = 1; var v712 = 1; var v713 = 1; var v714 = 1; var v715 = 1; var v716 = 1; var v717 = 1; var v718 = 1; var v719 = 1; var v720 = 1;
+  var v721 = 1; var v722 = 1; var v723 = 1; var v724 = 1; var v725 = 1; var v726 = 1; var v727 = 1; var v728 = 1; var v729 = 1; var v730 = 1;
+  var v731 = 1; var v732 = 1; var v733 = 1; var v734 = 1; var v735 = 1; var v736 = 1; var v737 = 1; var v738 = 1; var v739 = 1; var v740 = 1;
+  var v741 = 1; var v742 = 1; var v743 = 1; var v744 = 1; var v745 = 1; var v746 = 1; var v747 = 1; var v748 = 1; var v749 = 1; var v750 = 1;
+  var v751 = 1; var v752 = 1; var v753 = 1; var v754 = 1; var v755 = 1; var v756 = 1; var v757 = 1; var v758 = 1; var v759 = 1; var v760 = 1;
+  var v761 = 1; var v762 = 1; var v763 = 1; var v764 = 1; var v765 = 1; var v766 = 1; var v767 = 1; var v768 = 1; var v769 = 1; var v770 = 1;
+  var v771 = 1; var v772 = 1; var v773 = 1; var v774 = 1; var v775 = 1; var v776 = 1; var v777 = 1; var v778 = 1; var v779 = 1; var v780 = 1;
+  var v781 = 1; var v782 = 1; var v783 = 1; var v784 = 1; var v785 = 1; var v786 = 1; var v787 = 1; var v788 = 1; var v789 = 1; var v790 = 1;
+  var v791 = 1; var v792 = 1; var v793 = 1; var v794 = 1; var v795 = 1; var v796 = 1; var v797 = 1; var v798 = 1; var v799 = 1; var v800 = 1;
+  var v801 = 1; var v802 = 1; var v803 = 1; var v804 = 1; var v805 = 1; var v806 = 1; var v807 = 1; var v808 = 1; var v809 = 1; var v810 = 1;
+  var v811 = 1; var v812 = 1; var v813 = 1; var v814 = 1; var v815 = 1; var v816 = 1; var v817 = 1; var v818 = 1; var v819 = 1; var v820 = 1;
+  var v821 = 1; var v822 = 1; var v823 = 1; var v824 = 1; var v825 = 1; var v826 = 1; var v827 = 1; var v828 = 1; var v829 = 1; var v830 = 1;
+  var v831 = 1; var v832 = 1; var v833 = 1; var v834 = 1; var v835 = 1; var v836 = 1; var v837 = 1; var v838 = 1; var v839 = 1; var v840 = 1;
+  var v841 = 1; var v842 = 1; var v843 = 1; var v844 = 1; var v845 = 1; var v846 = 1; var v847 = 1; var v848 = 1; var v849 = 1; var v850 = 1;
+  var v851 = 1; var v852 = 1; var v853 = 1; var v854 = 1; var v855 = 1; var v856 = 1; var v857 = 1; var v858 = 1; var v859 = 1; var v860 = 1;
+  var v861 = 1; var v862 = 1; var v863 = 1; var v864 = 1; var v865 = 1; var v866 = 1; var v867 = 1; var v868 = 1; var v869 = 1; var v870 = 1;
+  var v871 = 1; var v872 = 1; var v873 = 1; var v874 = 1; var v875 = 1; var v876 = 1; var v877 = 1; var v878 = 1; var v879 = 1; var v880 = 1;
+  var v881 = 1; var v882 = 1; var v883 = 1; var v884 = 1; var v885 = 1; var v886 = 1; var v887 = 1; var v888 = 1; var v889 = 1; var v890 = 1;
+  var v891 = 1; var v892 = 1; var v893 = 1; var v894 = 1; var v895 = 1; var v896 = 1; var v897 = 1; var v898 = 1; var v899 = 1; var v900 = 1;
+  var v901 = 1; var v902 = 1; var v903 = 1; var v904 = 1; var v905 = 1; var v906 = 1; var v907 = 1; var v908 = 1; var v909 = 1; var v910 = 1;
+  var v911 = 1; var v912 = 1; var v913 = 1; var v914 = 1; var v915 = 1; var v916 = 1; var v917 = 1; var v918 = 1; var v919 = 1; var v920 = 1;
+  var v921 = 1; var v922 = 1; var v923 = 1; var v924 = 1; var v925 = 1; var v926 = 1; var v927 = 1; var v928 = 1; var v929 = 1; var v930 = 1;
+  var v931 = 1; var v932 = 1; var v933 = 1; var v934 = 1; var v935 = 1; var v936 = 1; var v937 = 1; var v938 = 1; var v939 = 1; var v940 = 1;
+  var v941 = 1; var v942 = 1; var v943 = 1; var v944 = 1; var v945 = 1; var v946 = 1; var v947 = 1; var v948 = 1; var v949 = 1; var v950 = 1;
+  var v951 = 1; var v952 = 1; var v953 = 1; var v954 = 1; var v955 = 1; var v956 = 1; var v957 = 1; var v958 = 1; var v959 = 1; var v960 = 1;
+  var v961 = 1; var v962 = 1; var v963 = 1; var v964 = 1; var v965 = 1; var v966 = 1; var v967 = 1; var v968 = 1; var v969 = 1; var v970 = 1;
+  var v971 = 1; var v972 = 1; var v973 = 1; var v974 = 1; var v975 = 1; var v976 = 1; var v977 = 1; var v978 = 1; var v979 = 1; var v980 = 1;
+  var v981 = 1; var v982 = 1; var v983 = 1; var v984 = 1; var v985 = 1; var v986 = 1; var v987 = 1; var v988 = 1; var v989 = 1; var v990 = 1;
+  var v991 = 1; var v992 = 1; var v993 = 1; var v994 = 1; var v995 = 1; var v996 = 1; var v997 = 1; var v998 = 1; var v999 = 1; var v1000 = 1;
+  return (v1 + (v2 + (v3 + (v4 + (v5 + (v6 + (v7 + (v8 + (v9 + (v10 + (v11 + (v12 + (v13 + (v14 + (v15 + (v16 + (v17 + (v18 + (v19 + (v20 + (v21 + (v22 + (v23 + (v24 + (v25 + (v26 + (v27 + (v28 + (v29 + (v30 + (v31 + (v32 + (v33 + (v34 + (v35 + (v36 + (v37 + (v38 + (v39 + (v40 + (v41 + (v42 + (v43 + (v44 + (v45 + (v46 + (v47 + (v48 + (v49 + (v50 + (v51 + (v52 + (v53 + (v54 + (v55 + (v56 + (v57 + (v58 + (v59 + (v60 + (v61 + (v62 + (v63 + (v64 + (v65 + (v66 + (v67 + (v68 + (v69 + (v70 + (v71 + (v72 + (v73 + (v74 + (v75 + (v76 + (v77 + (v78 + (v79 + (v80 + (v81 + (v82 + (v83 + (v84 + (v85 + (v86 + (v87 + (v88 + (v89 + (v90 + (v91 + (v92 + (v93 + (v94 + (v95 + (v96 + (v97 + (v98 + (v99 + (v100 + (v101 + (v102 + (v103 + (v104 + (v105 + (v106 + (v107 + (v108 + (v109 + (v110 + (v111 + (v112 + (v113 + (v114 + (v115 + (v116 + (v117 + (v118 + (v119 + (v120 + (v121 + (v122 + (v123 + (v124 + (v125 + (v126 + (v127 + (v128 + (v129 + (v130 + (v131 + (v132 + (v133 + (v134 + (v135 + (v136 + (v137 + (v138 + (v139 + (v140 + (v141 + (v142 + (v143 + (v144 + (v145 + (v146 + (v147 + (v148 + (v149 + (v150 + (v151 + (v152 + (v153 + (v154 + (v155 + (v156 + (v157 + (v158 + (v159 + (v160 + (v161 + (v162 + (v163 + (v164 + (v165 + (v166 + (v167 + (v168 + (v169 + (v170 + (v171 + (v172 + (v173 + (v174 + (v175 + (v176 + (v177 + (v178 + (v179 + (v180 + (v181 + (v182 + (v183 + (v184 + (v185 + (v186 + (v187 + (v188 + (v189 + (v190 + (v191 + (v192 + (v193 + (v194 + (v195 + (v196 + (v197 + (v198 + (v199 + (v200 + (v201 + (v202 + (v203 + (v204 + (v205 + (v206 + (v207 + (v208 + (v209 + (v210 + (v211 + (v212 + (v213 + (v214 + (v215 + (v216 + (v217 + (v218 + (v219 + (v220 + (v221 + (v222 + (v223 + (v224 + (v225 + (v226 + (v227 + (v228 + (v229 + (v230 + (v231 + (v232 + (v233 + (v234 + (v235 + (v236 + (v237 + (v238 + (v239 + (v240 + (v241 + (v242 + (v243 + (v244 + (v245 + (v246 + (v247 + (v248 + (v249 + (v250 + (v251 + (v252 + (v253 + (v254 + (v255 + (v256 + (v257 + (v258 + (v259 + (v260 + (v261 + (v262 + (v263 + (v264 + (v265 + (v266 + (v267 + (v268 + (v269 + (v270 + (v271 + (v272 + (v273 + (v274 + (v275 + (v276 + (v277 + (v278 + (v279 + (v280 + (v281 + (v282 + (v283 + (v284 + (v285 + (v286 + (v287 + (v288 + (v289 + (v290 + (v291 + (v292 + (v293 + (v294 + (v295 + (v296 + (v297 + (v298 + (v299 + (v300 + (v301 + (v302 + (v303 + (v304 + (v305 + (v306 + (v307 + (v308 + (v309 + (v310 + (v311 + (v312 + (v313 + (v314 + (v315 + (v316 + (v317 + (v318 + (v319 + (v320 + (v321 + (v322 + (v323 + (v324 + (v325 + (v326 + (v327 + (v328 + (v329 + (v330 + (v331 + (v332 + (v333 + (v334 + (v335 + (v336 + (v337 + (v338 + (v339 + (v340 + (v341 + (v342 + (v343 + (v344 + (v345 + (v346 + (v347 + (v348 + (v349 + (v350 + (v351 + (v352 + (v353 + (v354 + (v355 + (v356 + (v357 + (v358 + (v359 + (v360 + (v361 + (v362 + (v363 + (v364 + (v365 + (v366 + (v367 + (v368 + (v369 + (v370 + (v371 + (v372 + (v373 + (v374 + (v375 + (v376 + (v377 + (v378 + (v379 + (v380 + (v381 + (v382 + (v383 + (v384 + (v385 + (v386 + (v387 + (v388 + (v389 + (v390 + (v391 + (v392 + (v393 + (v394 + (v395 + (v396 + (v397 + (v398 + (v399 + (v400 + (v401 + (v402 + (v403 + (v404 + (v405 + (v406 + (v407 + (v408 + (v409 + (v410 + (v411 + (v412 + (v413 + (v414 + (v415 + (v416 + (v417 + (v418 + (v419 + (v420 + (v421 + (v422 + (v423 + (v424 + (v425 + (v426 + (v427 + (v428 + (v429 + (v430 + (v431 + (v432 + (v433 + (v434 + (v435 + (v436 + (v437 + (v438 + (v439 + (v440 + (v441 + (v442 + (v443 + (v444 + (v445 + (v446 + (v447 + (v448 + (v449 + (v450 + (v451 + (v452 + (v453 + (v454 + (v455 + (v456 + (v457 + (v458 + (v459 + (v460 + (v461 + (v462 + (v463 + (v464 + (v465 + (v466 + (v467 + (v468 + (v469 + (v470 + (v471 + (v472 + (v473 + (v474 + (v475 + (v476 + (v477 + (v478 + (v479 + (v480 + (v481 + (v482 + (v483 + (v484 + (v485 + (v486 + (v487 + (v488 + (v489 + (v490 + (v491 + (v492 + (v493 + (v494 + (v495 + (v496 + (v497 + (v498 + (v499 + (v500 + (v501 + (v502 + (v503 + (v504 + (v505 + (v506 + (v507 + (v508 + (v509 + (v510 + (v511 + (v512 + (v513 + (v514 + (v515 + (v516 + (v517 + (v518 + (v519 + (v520 + (v521 + (v522 + (v523 + (v524 + (v525 + (v526 + (v527 + (v528 + (v529 + (v530 + (v531 + (v532 + (v533 + (v534 + (v535 + (v536 + (v537 + (v538 + (v539 + (v540 + (v541 + (v542 + (v543 + (v544 + (v545 + (v546 + (v547 + (v548 + (v549 + (v550 + (v551 + (v552 + (v553 + (v554 + (v555 + (v556 + (v557 + (v558 + (v559 + (v560 + (v561 + (v562 + (v563 + (v564 + (v565 + (v566 + (v567 + (v568 + (v569 + (v570 + (v571 + (v572 + (v573 + (v574 + (v575 + (v576 + (v577 + (v578 + (v579 + (v580 + (v581 + (v582 + (v583 + (v584 + (v585 + (v586 + (v587 + (v588 + (v589 + (v590 + (v591 + (v592 + (v593 + (v594 + (v595 + (v596 + (v597 + (v598 + (v599 + (v600 + (v601 + (v602 + (v603 + (v604 + (v605 + (v606 + (v607 + (v608 + (v609 + (v610 + (v611 + (v612 + (v613 + (v614 + (v615 + (v616 + (v617 + (v618 + (v619 + (v620 + (v621 + (v622 + (v623 + (v624 + (v625 + (v626 + (v627 + (v628 + (v629 + (v630 + (v631 + (v632 + (v633 + (v634 + (v635 + (v636 + (v637 + (v638 + (v639 + (v640 + (v641 + (v642 + (v643 + (v644 + (v645 + (v646 + (v647 + (v648 + (v649 + (v650 + (v651 + (v652 + (v653 + (v654 + (v655 + (v656 + (v657 + (v658 + (v659 + (v660 + (v661 + (v662 + (v663 + (v664 + (v665 + (v666 + (v667 + (v668 + (v669 + (v670 + (v671 + (v672 + (v673 + (v674 + (v675 + (v676 + (v677 + (v678 + (v679 + (v680 + (v681 + (v682 + (v683 + (v684 + (v685 + (v686 + (v687 + (v688 + (v689 + (v690 + (v691 + (v692 + (v693 + (v694 + (v695 + (v696 + (v697 + (v698 + (v699 + (v700 + (v701 + (v702 + (v703 + (v704 + (v705 + (v706 + (v707 + (v708 + (v709 + (v710 + (v711 + (v712 + (v713 + (v714 + (v715 + (v716 + (v717 + (v718 + (v719 + (v720 + (v721 + (v722 + (v723 + (v724 + (v725 + (v726 + (v727 + (v728 + (v729 + (v730 + (v731 + (v732 + (v733 + (v734 + (v735 + (v736 + (v737 + (v738 + (v739 + (v740 + (v741 + (v742 + (v743 + (v744 + (v745 + (v746 + (v747 + (v748 + (v749 + (v750 + (v751 + (v752 + (v753 + (v754 + (v755 + (v756 + (v757 + (v758 + (v759 + (v760 + (v761 + (v762 + (v763 + (v764 + (v765 + (v766 + (v767 + (v768 + (v769 + (v770 + (v771 + (v772 + (v773 + (v774 + (v775 + (v776 + (v777 + (v778 + (v779 + (v780 + (v781 + (v782 + (v783 + (v784 + (v785 + (v786 + (v787 + (v788 + (v789 + (v790 + (v791 + (v792 + (v793 + (v794 + (v795 + (v796 + (v797 + (v798 + (v799 + (v800 + (v801 + (v802 + (v803 + (v804 + (v805 + (v806 + (v807 + (v808 + (v809 + (v810 + (v811 + (v812 + (v813 + (v814 + (v815 + (v816 + (v817 + (v818 + (v819 + (v820 + (v821 + (v822 + (v823 + (v824 + (v825 + (v826 + (v827 + (v828 + (v829 + (v830 + (v831 + (v832 + (v833 + (v834 + (v835 + (v836 + (v837 + (v838 + (v839 + (v840 + (v841 + (v842 + (v843 + (v844 + (v845 + (v846 + (v847 + (v848 + (v849 + (v850 + (v851 + (v852 + (v853 + (v854 + (v855 + (v856 + (v857 + (v858 + (v859 + (v860 + (v861 + (v862 + (v863 + (v864 + (v865 + (v866 + (v867 + (v868 + (v869 + (v870 + (v871 + (v872 + (v873 + (v874 + (v875 + (v876 + (v877 + (v878 + (v879 + (v880 + (v881 + (v882 + (v883 + (v884 + (v885 + (v886 + (v887 + (v888 + (v889 + (v890 + (v891 + (v892 + (v893 + (v894 + (v895 + (v896 + (v897 + (v898 + (v899 + (v900 + (v901 + (v902 + (v903 + (v904 + (v905 + (v906 + (v907 + (v908 + (v909 + (v910 + (v911 + (v912 + (v913 + (v914 + (v915 + (v916 + (v917 + (v918 + (v919 + (v920 + (v921 + (v922 + (v923 + (v924 + (v925 + (v926 + (v927 + (v928 + (v929 + (v930 + (v931 + (v932 + (v933 + (v934 + (v935 + (v936 + (v937 + (v938 + (v939 + (v940 + (v941 + (v942 + (v943 + (v944 + (v945 + (v946 + (v947 + (v948 + (v949 + (v950 + (v951 + (v952 + (v953 + (v954 + (v955 + (v956 + (v957 + (v958 + (v959 + (v960 + (v961 + (v962 + (v963 + (v964 + (v965 + (v966 + (v967 + (v968 + (v969 + (v970 + (v971 + (v972 + (v973 + (v974 + (v975 + (v976 + (v977 + (v978 + (v979 + (v980 + (v981 + (v982 + (v983 + (v984 + (v985 + (v986 + (v987 + (v988 + (v989 + (v990 + (v991 + (v992 + (v993 + (v994 + (v995 + (v996 + (v997 + (v998 + (v999 + v1000)))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))));
+}
+
+var f = fiber(wide);
+print(resume(f)); // expect: 1000
+print(wide()); // expect: 1000
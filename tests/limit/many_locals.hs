@@ -0,0 +1,55 @@
+func f() {
+  var v001 = 1; var v002 = 2; var v003 = 3; var v004 = 4; var v005 = 5; var v006 = 6; var v007 = 7; var v008 = 8;
+  var v009 = 9; var v010 = 10; var v011 = 11; var v012 = 12; var v013 = 13; var v014 = 14; var v015 = 15; var v016 = 16;
+  var v017 = 17; var v018 = 18; var v019 = 19; var v020 = 20; var v021 = 21; var v022 = 22; var v023 = 23; var v024 = 24;
+  var v025 = 25; var v026 = 26; var v027 = 27; var v028 = 28; var v029 = 29; var v030 = 30; var v031 = 31; var v032 = 32;
+  var v033 = 33; var v034 = 34; var v035 = 35; var v036 = 36; var v037 = 37; var v038 = 38; var v039 = 39; var v040 = 40;
+  var v041 = 41; var v042 = 42; var v043 = 43; var v044 = 44; var v045 = 45; var v046 = 46; var v047 = 47; var v048 = 48;
+  var v049 = 49; var v050 = 50; var v051 = 51; var v052 = 52; var v053 = 53; var v054 = 54; var v055 = 55; var v056 = 56;
+  var v057 = 57; var v058 = 58; var v059 = 59; var v060 = 60; var v061 = 61; var v062 = 62; var v063 = 63; var v064 = 64;
+  var v065 = 65; var v066 = 66; var v067 = 67; var v068 = 68; var v069 = 69; var v070 = 70; var v071 = 71; var v072 = 72;
+  var v073 = 73; var v074 = 74; var v075 = 75; var v076 = 76; var v077 = 77; var v078 = 78; var v079 = 79; var v080 = 80;
+  var v081 = 81; var v082 = 82; var v083 = 83; var v084 = 84; var v085 = 85; var v086 = 86; var v087 = 87; var v088 = 88;
+  var v089 = 89; var v090 = 90; var v091 = 91; var v092 = 92; var v093 = 93; var v094 = 94; var v095 = 95; var v096 = 96;
+  var v097 = 97; var v098 = 98; var v099 = 99; var v100 = 100; var v101 = 101; var v102 = 102; var v103 = 103; var v104 = 104;
+  var v105 = 105; var v106 = 106; var v107 = 107; var v108 = 108; var v109 = 109; var v110 = 110; var v111 = 111; var v112 = 112;
+  var v113 = 113; var v114 = 114; var v115 = 115; var v116 = 116; var v117 = 117; var v118 = 118; var v119 = 119; var v120 = 120;
+  var v121 = 121; var v122 = 122; var v123 = 123; var v124 = 124; var v125 = 125; var v126 = 126; var v127 = 127; var v128 = 128;
+  var v129 = 129; var v130 = 130; var v131 = 131; var v132 = 132; var v133 = 133; var v134 = 134; var v135 = 135; var v136 = 136;
+  var v137 = 137; var v138 = 138; var v139 = 139; var v140 = 140; var v141 = 141; var v142 = 142; var v143 = 143; var v144 = 144;
+  var v145 = 145; var v146 = 146; var v147 = 147; var v148 = 148; var v149 = 149; var v150 = 150; var v151 = 151; var v152 = 152;
+  var v153 = 153; var v154 = 154; var v155 = 155; var v156 = 156; var v157 = 157; var v158 = 158; var v159 = 159; var v160 = 160;
+  var v161 = 161; var v162 = 162; var v163 = 163; var v164 = 164; var v165 = 165; var v166 = 166; var v167 = 167; var v168 = 168;
+  var v169 = 169; var v170 = 170; var v171 = 171; var v172 = 172; var v173 = 173; var v174 = 174; var v175 = 175; var v176 = 176;
+  var v177 = 177; var v178 = 178; var v179 = 179; var v180 = 180; var v181 = 181; var v182 = 182; var v183 = 183; var v184 = 184;
+  var v185 = 185; var v186 = 186; var v187 = 187; var v188 = 188; var v189 = 189; var v190 = 190; var v191 = 191; var v192 = 192;
+  var v193 = 193; var v194 = 194; var v195 = 195; var v196 = 196; var v197 = 197; var v198 = 198; var v199 = 199; var v200 = 200;
+  var v201 = 201; var v202 = 202; var v203 = 203; var v204 = 204; var v205 = 205; var v206 = 206; var v207 = 207; var v208 = 208;
+  var v209 = 209; var v210 = 210; var v211 = 211; var v212 = 212; var v213 = 213; var v214 = 214; var v215 = 215; var v216 = 216;
+  var v217 = 217; var v218 = 218; var v219 = 219; var v220 = 220; var v221 = 221; var v222 = 222; var v223 = 223; var v224 = 224;
+  var v225 = 225; var v226 = 226; var v227 = 227; var v228 = 228; var v229 = 229; var v230 = 230; var v231 = 231; var v232 = 232;
+  var v233 = 233; var v234 = 234; var v235 = 235; var v236 = 236; var v237 = 237; var v238 = 238; var v239 = 239; var v240 = 240;
+  var v241 = 241; var v242 = 242; var v243 = 243; var v244 = 244; var v245 = 245; var v246 = 246; var v247 = 247; var v248 = 248;
+  var v249 = 249; var v250 = 250; var v251 = 251; var v252 = 252; var v253 = 253; var v254 = 254; var v255 = 255; var v256 = 256;
+  var v257 = 257; var v258 = 258; var v259 = 259; var v260 = 260; var v261 = 261; var v262 = 262; var v263 = 263; var v264 = 264;
+  var v265 = 265; var v266 = 266; var v267 = 267; var v268 = 268; var v269 = 269; var v270 = 270; var v271 = 271; var v272 = 272;
+  var v273 = 273; var v274 = 274; var v275 = 275; var v276 = 276; var v277 = 277; var v278 = 278; var v279 = 279; var v280 = 280;
+  var v281 = 281; var v282 = 282; var v283 = 283; var v284 = 284; var v285 = 285; var v286 = 286; var v287 = 287; var v288 = 288;
+  var v289 = 289; var v290 = 290; var v291 = 291; var v292 = 292; var v293 = 293; var v294 = 294; var v295 = 295; var v296 = 296;
+  var v297 = 297; var v298 = 298; var v299 = 299; var v300 = 300;
+  var captured = 7;
+  var get = func() => captured;
+  captured += 3;
+  var [p, q] = [4, 5];
+  [p, q] = [q, p];
+  var sum = 0;
+  for (i, x in [1, 2, 3]) {
+    sum += i * x;
+  }
+  print(v001 + v300); // expect: 301
+  print(get()); // expect: 10
+  print(p - q); // expect: 1
+  print(sum); // expect: 8
+}
+
+f();
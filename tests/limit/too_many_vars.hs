@@ -1,37 +1,134 @@
 func f() {
-  // var v00 First slot already taken
+  // var v000 First slot already taken
 
-  var v01; var v02; var v03; var v04; var v05; var v06; var v07;
-  var v08; var v09; var v0a; var v0b; var v0c; var v0d; var v0e; var v0f;
-  var v10; var v11; var v12; var v13; var v14; var v15; var v16; var v17;
-  var v18; var v19; var v1a; var v1b; var v1c; var v1d; var v1e; var v1f;
-  var v20; var v21; var v22; var v23; var v24; var v25; var v26; var v27;
-  var v28; var v29; var v2a; var v2b; var v2c; var v2d; var v2e; var v2f;
-  var v30; var v31; var v32; var v33; var v34; var v35; var v36; var v37;
-  var v38; var v39; var v3a; var v3b; var v3c; var v3d; var v3e; var v3f;
-  var v40; var v41; var v42; var v43; var v44; var v45; var v46; var v47;
-  var v48; var v49; var v4a; var v4b; var v4c; var v4d; var v4e; var v4f;
-  var v50; var v51; var v52; var v53; var v54; var v55; var v56; var v57;
-  var v58; var v59; var v5a; var v5b; var v5c; var v5d; var v5e; var v5f;
-  var v60; var v61; var v62; var v63; var v64; var v65; var v66; var v67;
-  var v68; var v69; var v6a; var v6b; var v6c; var v6d; var v6e; var v6f;
-  var v70; var v71; var v72; var v73; var v74; var v75; var v76; var v77;
-  var v78; var v79; var v7a; var v7b; var v7c; var v7d; var v7e; var v7f;
-  var v80; var v81; var v82; var v83; var v84; var v85; var v86; var v87;
-  var v88; var v89; var v8a; var v8b; var v8c; var v8d; var v8e; var v8f;
-  var v90; var v91; var v92; var v93; var v94; var v95; var v96; var v97;
-  var v98; var v99; var v9a; var v9b; var v9c; var v9d; var v9e; var v9f;
-  var va0; var va1; var va2; var va3; var va4; var va5; var va6; var va7;
-  var va8; var va9; var vaa; var vab; var vac; var vad; var vae; var vaf;
-  var vb0; var vb1; var vb2; var vb3; var vb4; var vb5; var vb6; var vb7;
-  var vb8; var vb9; var vba; var vbb; var vbc; var vbd; var vbe; var vbf;
-  var vc0; var vc1; var vc2; var vc3; var vc4; var vc5; var vc6; var vc7;
-  var vc8; var vc9; var vca; var vcb; var vcc; var vcd; var vce; var vcf;
-  var vd0; var vd1; var vd2; var vd3; var vd4; var vd5; var vd6; var vd7;
-  var vd8; var vd9; var vda; var vdb; var vdc; var vdd; var vde; var vdf;
-  var ve0; var ve1; var ve2; var ve3; var ve4; var ve5; var ve6; var ve7;
-  var ve8; var ve9; var vea; var veb; var vec; var ved; var vee; var vef;
-  var vf0; var vf1; var vf2; var vf3; var vf4; var vf5; var vf6; var vf7;
-  var vf8; var vf9; var vfa; var vfb; var vfc; var vfd; var vfe; var vff;
-  var oops; // expect error line 36
+  var v001; var v002; var v003; var v004; var v005; var v006; var v007;
+  var v008; var v009; var v00a; var v00b; var v00c; var v00d; var v00e; var v00f;
+  var v010; var v011; var v012; var v013; var v014; var v015; var v016; var v017;
+  var v018; var v019; var v01a; var v01b; var v01c; var v01d; var v01e; var v01f;
+  var v020; var v021; var v022; var v023; var v024; var v025; var v026; var v027;
+  var v028; var v029; var v02a; var v02b; var v02c; var v02d; var v02e; var v02f;
+  var v030; var v031; var v032; var v033; var v034; var v035; var v036; var v037;
+  var v038; var v039; var v03a; var v03b; var v03c; var v03d; var v03e; var v03f;
+  var v040; var v041; var v042; var v043; var v044; var v045; var v046; var v047;
+  var v048; var v049; var v04a; var v04b; var v04c; var v04d; var v04e; var v04f;
+  var v050; var v051; var v052; var v053; var v054; var v055; var v056; var v057;
+  var v058; var v059; var v05a; var v05b; var v05c; var v05d; var v05e; var v05f;
+  var v060; var v061; var v062; var v063; var v064; var v065; var v066; var v067;
+  var v068; var v069; var v06a; var v06b; var v06c; var v06d; var v06e; var v06f;
+  var v070; var v071; var v072; var v073; var v074; var v075; var v076; var v077;
+  var v078; var v079; var v07a; var v07b; var v07c; var v07d; var v07e; var v07f;
+  var v080; var v081; var v082; var v083; var v084; var v085; var v086; var v087;
+  var v088; var v089; var v08a; var v08b; var v08c; var v08d; var v08e; var v08f;
+  var v090; var v091; var v092; var v093; var v094; var v095; var v096; var v097;
+  var v098; var v099; var v09a; var v09b; var v09c; var v09d; var v09e; var v09f;
+  var v0a0; var v0a1; var v0a2; var v0a3; var v0a4; var v0a5; var v0a6; var v0a7;
+  var v0a8; var v0a9; var v0aa; var v0ab; var v0ac; var v0ad; var v0ae; var v0af;
+  var v0b0; var v0b1; var v0b2; var v0b3; var v0b4; var v0b5; var v0b6; var v0b7;
+  var v0b8; var v0b9; var v0ba; var v0bb; var v0bc; var v0bd; var v0be; var v0bf;
+  var v0c0; var v0c1; var v0c2; var v0c3; var v0c4; var v0c5; var v0c6; var v0c7;
+  var v0c8; var v0c9; var v0ca; var v0cb; var v0cc; var v0cd; var v0ce; var v0cf;
+  var v0d0; var v0d1; var v0d2; var v0d3; var v0d4; var v0d5; var v0d6; var v0d7;
+  var v0d8; var v0d9; var v0da; var v0db; var v0dc; var v0dd; var v0de; var v0df;
+  var v0e0; var v0e1; var v0e2; var v0e3; var v0e4; var v0e5; var v0e6; var v0e7;
+  var v0e8; var v0e9; var v0ea; var v0eb; var v0ec; var v0ed; var v0ee; var v0ef;
+  var v0f0; var v0f1; var v0f2; var v0f3; var v0f4; var v0f5; var v0f6; var v0f7;
+  var v0f8; var v0f9; var v0fa; var v0fb; var v0fc; var v0fd; var v0fe; var v0ff;
+  var v100; var v101; var v102; var v103; var v104; var v105; var v106; var v107;
+  var v108; var v109; var v10a; var v10b; var v10c; var v10d; var v10e; var v10f;
+  var v110; var v111; var v112; var v113; var v114; var v115; var v116; var v117;
+  var v118; var v119; var v11a; var v11b; var v11c; var v11d; var v11e; var v11f;
+  var v120; var v121; var v122; var v123; var v124; var v125; var v126; var v127;
+  var v128; var v129; var v12a; var v12b; var v12c; var v12d; var v12e; var v12f;
+  var v130; var v131; var v132; var v133; var v134; var v135; var v136; var v137;
+  var v138; var v139; var v13a; var v13b; var v13c; var v13d; var v13e; var v13f;
+  var v140; var v141; var v142; var v143; var v144; var v145; var v146; var v147;
+  var v148; var v149; var v14a; var v14b; var v14c; var v14d; var v14e; var v14f;
+  var v150; var v151; var v152; var v153; var v154; var v155; var v156; var v157;
+  var v158; var v159; var v15a; var v15b; var v15c; var v15d; var v15e; var v15f;
+  var v160; var v161; var v162; var v163; var v164; var v165; var v166; var v167;
+  var v168; var v169; var v16a; var v16b; var v16c; var v16d; var v16e; var v16f;
+  var v170; var v171; var v172; var v173; var v174; var v175; var v176; var v177;
+  var v178; var v179; var v17a; var v17b; var v17c; var v17d; var v17e; var v17f;
+  var v180; var v181; var v182; var v183; var v184; var v185; var v186; var v187;
+  var v188; var v189; var v18a; var v18b; var v18c; var v18d; var v18e; var v18f;
+  var v190; var v191; var v192; var v193; var v194; var v195; var v196; var v197;
+  var v198; var v199; var v19a; var v19b; var v19c; var v19d; var v19e; var v19f;
+  var v1a0; var v1a1; var v1a2; var v1a3; var v1a4; var v1a5; var v1a6; var v1a7;
+  var v1a8; var v1a9; var v1aa; var v1ab; var v1ac; var v1ad; var v1ae; var v1af;
+  var v1b0; var v1b1; var v1b2; var v1b3; var v1b4; var v1b5; var v1b6; var v1b7;
+  var v1b8; var v1b9; var v1ba; var v1bb; var v1bc; var v1bd; var v1be; var v1bf;
+  var v1c0; var v1c1; var v1c2; var v1c3; var v1c4; var v1c5; var v1c6; var v1c7;
+  var v1c8; var v1c9; var v1ca; var v1cb; var v1cc; var v1cd; var v1ce; var v1cf;
+  var v1d0; var v1d1; var v1d2; var v1d3; var v1d4; var v1d5; var v1d6; var v1d7;
+  var v1d8; var v1d9; var v1da; var v1db; var v1dc; var v1dd; var v1de; var v1df;
+  var v1e0; var v1e1; var v1e2; var v1e3; var v1e4; var v1e5; var v1e6; var v1e7;
+  var v1e8; var v1e9; var v1ea; var v1eb; var v1ec; var v1ed; var v1ee; var v1ef;
+  var v1f0; var v1f1; var v1f2; var v1f3; var v1f4; var v1f5; var v1f6; var v1f7;
+  var v1f8; var v1f9; var v1fa; var v1fb; var v1fc; var v1fd; var v1fe; var v1ff;
+  var v200; var v201; var v202; var v203; var v204; var v205; var v206; var v207;
+  var v208; var v209; var v20a; var v20b; var v20c; var v20d; var v20e; var v20f;
+  var v210; var v211; var v212; var v213; var v214; var v215; var v216; var v217;
+  var v218; var v219; var v21a; var v21b; var v21c; var v21d; var v21e; var v21f;
+  var v220; var v221; var v222; var v223; var v224; var v225; var v226; var v227;
+  var v228; var v229; var v22a; var v22b; var v22c; var v22d; var v22e; var v22f;
+  var v230; var v231; var v232; var v233; var v234; var v235; var v236; var v237;
+  var v238; var v239; var v23a; var v23b; var v23c; var v23d; var v23e; var v23f;
+  var v240; var v241; var v242; var v243; var v244; var v245; var v246; var v247;
+  var v248; var v249; var v24a; var v24b; var v24c; var v24d; var v24e; var v24f;
+  var v250; var v251; var v252; var v253; var v254; var v255; var v256; var v257;
+  var v258; var v259; var v25a; var v25b; var v25c; var v25d; var v25e; var v25f;
+  var v260; var v261; var v262; var v263; var v264; var v265; var v266; var v267;
+  var v268; var v269; var v26a; var v26b; var v26c; var v26d; var v26e; var v26f;
+  var v270; var v271; var v272; var v273; var v274; var v275; var v276; var v277;
+  var v278; var v279; var v27a; var v27b; var v27c; var v27d; var v27e; var v27f;
+  var v280; var v281; var v282; var v283; var v284; var v285; var v286; var v287;
+  var v288; var v289; var v28a; var v28b; var v28c; var v28d; var v28e; var v28f;
+  var v290; var v291; var v292; var v293; var v294; var v295; var v296; var v297;
+  var v298; var v299; var v29a; var v29b; var v29c; var v29d; var v29e; var v29f;
+  var v2a0; var v2a1; var v2a2; var v2a3; var v2a4; var v2a5; var v2a6; var v2a7;
+  var v2a8; var v2a9; var v2aa; var v2ab; var v2ac; var v2ad; var v2ae; var v2af;
+  var v2b0; var v2b1; var v2b2; var v2b3; var v2b4; var v2b5; var v2b6; var v2b7;
+  var v2b8; var v2b9; var v2ba; var v2bb; var v2bc; var v2bd; var v2be; var v2bf;
+  var v2c0; var v2c1; var v2c2; var v2c3; var v2c4; var v2c5; var v2c6; var v2c7;
+  var v2c8; var v2c9; var v2ca; var v2cb; var v2cc; var v2cd; var v2ce; var v2cf;
+  var v2d0; var v2d1; var v2d2; var v2d3; var v2d4; var v2d5; var v2d6; var v2d7;
+  var v2d8; var v2d9; var v2da; var v2db; var v2dc; var v2dd; var v2de; var v2df;
+  var v2e0; var v2e1; var v2e2; var v2e3; var v2e4; var v2e5; var v2e6; var v2e7;
+  var v2e8; var v2e9; var v2ea; var v2eb; var v2ec; var v2ed; var v2ee; var v2ef;
+  var v2f0; var v2f1; var v2f2; var v2f3; var v2f4; var v2f5; var v2f6; var v2f7;
+  var v2f8; var v2f9; var v2fa; var v2fb; var v2fc; var v2fd; var v2fe; var v2ff;
+  var v300; var v301; var v302; var v303; var v304; var v305; var v306; var v307;
+  var v308; var v309; var v30a; var v30b; var v30c; var v30d; var v30e; var v30f;
+  var v310; var v311; var v312; var v313; var v314; var v315; var v316; var v317;
+  var v318; var v319; var v31a; var v31b; var v31c; var v31d; var v31e; var v31f;
+  var v320; var v321; var v322; var v323; var v324; var v325; var v326; var v327;
+  var v328; var v329; var v32a; var v32b; var v32c; var v32d; var v32e; var v32f;
+  var v330; var v331; var v332; var v333; var v334; var v335; var v336; var v337;
+  var v338; var v339; var v33a; var v33b; var v33c; var v33d; var v33e; var v33f;
+  var v340; var v341; var v342; var v343; var v344; var v345; var v346; var v347;
+  var v348; var v349; var v34a; var v34b; var v34c; var v34d; var v34e; var v34f;
+  var v350; var v351; var v352; var v353; var v354; var v355; var v356; var v357;
+  var v358; var v359; var v35a; var v35b; var v35c; var v35d; var v35e; var v35f;
+  var v360; var v361; var v362; var v363; var v364; var v365; var v366; var v367;
+  var v368; var v369; var v36a; var v36b; var v36c; var v36d; var v36e; var v36f;
+  var v370; var v371; var v372; var v373; var v374; var v375; var v376; var v377;
+  var v378; var v379; var v37a; var v37b; var v37c; var v37d; var v37e; var v37f;
+  var v380; var v381; var v382; var v383; var v384; var v385; var v386; var v387;
+  var v388; var v389; var v38a; var v38b; var v38c; var v38d; var v38e; var v38f;
+  var v390; var v391; var v392; var v393; var v394; var v395; var v396; var v397;
+  var v398; var v399; var v39a; var v39b; var v39c; var v39d; var v39e; var v39f;
+  var v3a0; var v3a1; var v3a2; var v3a3; var v3a4; var v3a5; var v3a6; var v3a7;
+  var v3a8; var v3a9; var v3aa; var v3ab; var v3ac; var v3ad; var v3ae; var v3af;
+  var v3b0; var v3b1; var v3b2; var v3b3; var v3b4; var v3b5; var v3b6; var v3b7;
+  var v3b8; var v3b9; var v3ba; var v3bb; var v3bc; var v3bd; var v3be; var v3bf;
+  var v3c0; var v3c1; var v3c2; var v3c3; var v3c4; var v3c5; var v3c6; var v3c7;
+  var v3c8; var v3c9; var v3ca; var v3cb; var v3cc; var v3cd; var v3ce; var v3cf;
+  var v3d0; var v3d1; var v3d2; var v3d3; var v3d4; var v3d5; var v3d6; var v3d7;
+  var v3d8; var v3d9; var v3da; var v3db; var v3dc; var v3dd; var v3de; var v3df;
+  var v3e0; var v3e1; var v3e2; var v3e3; var v3e4; var v3e5; var v3e6; var v3e7;
+  var v3e8; var v3e9; var v3ea; var v3eb; var v3ec; var v3ed; var v3ee; var v3ef;
+  var v3f0; var v3f1; var v3f2; var v3f3; var v3f4; var v3f5; var v3f6; var v3f7;
+  var v3f8; var v3f9; var v3fa; var v3fb; var v3fc; var v3fd; var v3fe; var v3ff;
+
+  var oops; // expect error line 133
 }
@@ -0,0 +1,122 @@
+// Runs many independent states at once, each on its own thread, and checks
+// that every one of them produces the same output as a state run alone.
+// Odd threads compile the script themselves, even threads all load one
+// shared program.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hobbyscript.h"
+#include "vm.h"
+
+#define THREAD_COUNT 8
+#define ROUNDS 10
+
+// Exercises the compiler, the GC, strings, arrays, closures and sorting
+// with a comparator, then leaves a callback for the host to call.
+static const char* script =
+  "global var calls = 0;\n"
+  "global func step(n) {\n"
+  "  calls += 1;\n"
+  "  return n * 2 + calls;\n"
+  "}\n"
+  "func makeCounter() {\n"
+  "  var count = 0;\n"
+  "  return func() { count += 1; return count; };\n"
+  "}\n"
+  "var counter = makeCounter();\n"
+  "var arr = [];\n"
+  "var i = 0;\n"
+  "while (i < 2000) {\n"
+  "  arr.push(toString((i * 7919) % 2000) .. \"-\" .. toString(counter()));\n"
+  "  i += 1;\n"
+  "}\n"
+  "arr.sort();\n"
+  "var nums = [];\n"
+  "i = 0;\n"
+  "while (i < 2000) { nums.push((i * 31) % 977); i += 1; }\n"
+  "nums.sort(func(a, b) { return a > b; });\n"
+  "print(arr.len(), arr[0], nums[0], nums[1999], counter());\n"
+  "for (x in nums.view(0, 5)) { print(x); }\n"
+  "var fruit = [\"pear\", \"fig\", -2, true];\n"
+  "fruit.sort(func(a, b) { return toString(a) < toString(b); });\n"
+  "print(fruit[0], fruit[3]);\n";
+
+struct Result {
+  char* output;
+  size_t size;
+};
+
+static struct hs_Program* program;
+
+static void runScript(struct Result* result, bool shared) {
+  FILE* out = open_memstream(&result->output, &result->size);
+  struct hs_State* H = hs_newState();
+  hs_setOutput(H, out, out);
+
+  if (shared) {
+    hs_loadProgram(H, program);
+    hs_call(H, 0, 0);
+  } else {
+    interpret(H, script);
+  }
+  for (int i = 0; i < 100; i++) {
+    hs_getGlobal(H, "step");
+    hs_pushNumber(H, i);
+    if (hs_pcall(H, 1, 1) != HS_OK) {
+      fprintf(out, "error: %s\n", hs_toString(H, -1, NULL));
+    }
+    fprintf(out, "%g\n", hs_toNumber(H, -1));
+    hs_pop(H);
+  }
+
+  hs_freeState(H);
+  fclose(out);
+}
+
+static struct Result expected;
+static int failures[THREAD_COUNT];
+
+static void* worker(void* arg) {
+  int id = (int)(size_t)arg;
+  for (int round = 0; round < ROUNDS; round++) {
+    struct Result result;
+    runScript(&result, id % 2 == 0);
+    if (result.size != expected.size
+        || memcmp(result.output, expected.output, result.size) != 0) {
+      failures[id]++;
+    }
+    free(result.output);
+  }
+  return NULL;
+}
+
+int main() {
+  runScript(&expected, false);
+  program = hs_compileProgram(script, stderr);
+
+  pthread_t threads[THREAD_COUNT];
+  for (int i = 0; i < THREAD_COUNT; i++) {
+    pthread_create(&threads[i], NULL, worker, (void*)(size_t)i);
+  }
+
+  int failed = 0;
+  for (int i = 0; i < THREAD_COUNT; i++) {
+    pthread_join(threads[i], NULL);
+    failed += failures[i];
+  }
+  free(expected.output);
+  hs_freeProgram(program);
+
+  if (failed > 0) {
+    fprintf(stderr, "%d of %d runs produced different output.\n",
+        failed, THREAD_COUNT * ROUNDS);
+    return 1;
+  }
+  printf("%d states on %d threads matched.\n", THREAD_COUNT * ROUNDS, THREAD_COUNT);
+  return 0;
+}